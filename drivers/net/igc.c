@@ -76,10 +76,27 @@
 #define IGC_TX_QUOTA           IGC_TX_DESC
 #define IGC_RX_QUOTA           (IGC_RX_DESC + CONFIG_NET_IGC_RXSPARE)
 
+/* RX/TX queue pairs.  With more than one, each queue pair has its own
+ * MSI-X vector and the last vector takes the other causes.
+ */
+
+#ifdef CONFIG_NETDEV_RSS
+#  define IGC_NQUEUES          CONFIG_NET_IGC_NQUEUES
+#else
+#  define IGC_NQUEUES          1
+#endif
+
+#if IGC_NQUEUES > 1
+#  define IGC_NVECTORS         (IGC_NQUEUES + 1)
+#  define IGC_VECTOR_OTHER     IGC_NQUEUES
+#else
+#  define IGC_NVECTORS         1
+#endif
+
 /* NOTE: CONFIG_IOB_ALIGNMENT must match system D-CACHE line size */
 
-#if CONFIG_IOB_NBUFFERS < IGC_RX_QUOTA + IGC_TX_QUOTA
-#  error CONFIG_IOB_NBUFFERS must be > (IGC_RX_QUOTA + IGC_TX_QUOTA)
+#if CONFIG_IOB_NBUFFERS < (IGC_RX_QUOTA + IGC_TX_QUOTA) * IGC_NQUEUES
+#  error CONFIG_IOB_NBUFFERS must be > (IGC_RX_QUOTA + IGC_TX_QUOTA) * nqueues
 #endif
 
 #if CONFIG_IOB_BUFSIZE < IGC_PKTBUF_SIZE
@@ -93,16 +110,30 @@
 #define IGC_IO_BAR             2
 #define IGC_MSIX_BAR           3
 
+#if IGC_NQUEUES > 1
+/* For MSI-X we allocate one vector per queue pair, with the queue causes
+ * cleared automatically, and the last vector to the other causes.
+ */
+
+#  define IGC_MSIX_GPIE        (IGC_GPIE_MSIX | IGC_GPIE_NSICR | \
+                                IGC_GPIE_EIAME | IGC_GPIE_PBASUPPORT)
+#  define IGC_MSIX_IMS         (IGC_IC_LSC | IGC_IC_RXMISS)
+#  define IGC_MSIX_EIMS        ((1 << IGC_NVECTORS) - 1)
+#  define IGC_MSIX_EIAC        ((1 << IGC_NQUEUES) - 1)
+#  define IGC_MSIX_IVARMSC     (IGC_IVARMSC_OTHER_VAL | \
+                                (IGC_VECTOR_OTHER << IGC_IVARMSC_OTHER_SHIFT))
+#else
 /* For MSI-X we allocate all interrupts to MSI-X vector 0 */
 
-#define IGC_GPIE_MSIX_SINGLE   (IGC_GPIE_NSICR | IGC_GPIE_EIAME | \
+#  define IGC_MSIX_GPIE        (IGC_GPIE_NSICR | IGC_GPIE_EIAME | \
                                 IGC_GPIE_PBASUPPORT)
-#define IGC_MSIX_IMS           (IGC_IC_TXDW | IGC_IC_LSC | \
+#  define IGC_MSIX_IMS         (IGC_IC_TXDW | IGC_IC_LSC | \
                                 IGC_IC_RXMISS | IGC_IC_RXDW)
-#define IGC_MSIX_EIMS          (IGC_EIMS_NOMSIX_OTHER | \
+#  define IGC_MSIX_EIMS        (IGC_EIMS_NOMSIX_OTHER | \
                                 IGC_EIMS_NOMSIX_RXTX0)
-#define IGC_MSIX_IVAR0         (IGC_IVAR0_RXQ0_VAL | IGC_IVAR0_TXQ0_VAL)
-#define IGC_MSIX_IVARMSC       (IGC_IVARMSC_OTHER_VAL)
+#  define IGC_MSIX_IVAR0       (IGC_IVAR0_RXQ0_VAL | IGC_IVAR0_TXQ0_VAL)
+#  define IGC_MSIX_IVARMSC     (IGC_IVARMSC_OTHER_VAL)
+#endif
 
 /*****************************************************************************
  * Private Types
@@ -116,14 +147,13 @@ struct igc_type_s
   uint32_t mta_regs;            /* MTA registers */
 };
 
-/* IGC private data */
+/* IGC RX/TX queue pair */
 
-struct igc_driver_s
+struct igc_driver_s;
+struct igc_queue_s
 {
-  /* This holds the information visible to the NuttX network */
-
-  struct netdev_lowerhalf_s dev;
-  struct work_s work;
+  FAR struct igc_driver_s *priv;
+  int qid;
 
   /* Packets list */
 
@@ -138,12 +168,26 @@ struct igc_driver_s
   size_t tx_now;
   size_t tx_done;
   size_t rx_now;
+};
+
+/* IGC private data */
+
+struct igc_driver_s
+{
+  /* This holds the information visible to the NuttX network */
+
+  struct netdev_lowerhalf_s dev;
+  struct work_s work;
+
+  /* RX/TX queues */
+
+  struct igc_queue_s queue[IGC_NQUEUES];
 
   /* PCI data */
 
   FAR struct pci_device_s     *pcidev;
   FAR const struct igc_type_s *type;
-  int                          irq;
+  int                          irq[IGC_NVECTORS];
   uint64_t                     base;
 
 #ifdef CONFIG_NET_MCASTGROUP
@@ -176,21 +220,32 @@ static void igc_dump_mem(FAR struct igc_driver_s *priv, FAR const char *msg);
 
 /* Rings management */
 
-static void igc_txclean(FAR struct igc_driver_s *priv);
-static void igc_rxclean(FAR struct igc_driver_s *priv);
+static void igc_txclean(FAR struct igc_queue_s *q);
+static void igc_rxclean(FAR struct igc_queue_s *q);
 
 /* Common TX logic */
 
+static int igc_transmit_queue(FAR struct netdev_lowerhalf_s *dev, int qid,
+                              FAR netpkt_t *pkt);
+#ifndef CONFIG_NETDEV_RSS
 static int igc_transmit(FAR struct netdev_lowerhalf_s *dev,
                         FAR netpkt_t *pkt);
+#endif
 
 /* Interrupt handling */
 
+static FAR netpkt_t *igc_receive_queue(FAR struct netdev_lowerhalf_s *dev,
+                                       int qid);
+#ifndef CONFIG_NETDEV_RSS
 static FAR netpkt_t *igc_receive(FAR struct netdev_lowerhalf_s *dev);
-static void igc_txdone(FAR struct netdev_lowerhalf_s *dev);
+#endif
+static void igc_txdone(FAR struct igc_queue_s *q);
 
 static void igc_msix_interrupt(FAR struct igc_driver_s *priv);
 static int igc_interrupt(int irq, FAR void *context, FAR void *arg);
+#if IGC_NQUEUES > 1
+static int igc_queue_interrupt(int irq, FAR void *context, FAR void *arg);
+#endif
 
 /* NuttX callback functions */
 
@@ -254,12 +309,29 @@ static struct pci_driver_s g_pci_igc_drv =
   .probe    = igc_probe,
 };
 
+#if IGC_NQUEUES > 1
+/* RSS hash key (the default key of the Microsoft RSS specification) */
+
+static const uint8_t g_igc_rsskey[IGC_RSSRK_SIZE] =
+{
+  0x6d, 0x5a, 0x56, 0xda, 0x25, 0x5b, 0x0e, 0xc2, 0x41, 0x67,
+  0x25, 0x3d, 0x43, 0xa3, 0x8f, 0xb0, 0xd0, 0xca, 0x2b, 0xcb,
+  0xae, 0x7b, 0x30, 0xb4, 0x77, 0xcb, 0x2d, 0xa3, 0x80, 0x30,
+  0xf2, 0x0c, 0x6a, 0x42, 0xb7, 0x3b, 0xbe, 0xac, 0x01, 0xfa
+};
+#endif
+
 static const struct netdev_ops_s g_igc_ops =
 {
   .ifup     = igc_ifup,
   .ifdown   = igc_ifdown,
+#ifdef CONFIG_NETDEV_RSS
+  .transmit_queue = igc_transmit_queue,
+  .receive_queue  = igc_receive_queue,
+#else
   .transmit = igc_transmit,
   .receive  = igc_receive,
+#endif
 #ifdef CONFIG_NET_MCASTGROUP
   .addmac   = igc_addmac,
   .rmmac    = igc_rmmac,
@@ -441,7 +513,7 @@ static void igc_dump_mem(FAR struct igc_driver_s *priv, FAR const char *msg)
  *   Clean transmission ring
  *
  * Input Parameters:
- *   priv - Reference to the driver state structure
+ *   q - Reference to the queue state structure
  *
  * Returned Value:
  *   None
@@ -451,30 +523,31 @@ static void igc_dump_mem(FAR struct igc_driver_s *priv, FAR const char *msg)
  *
  *****************************************************************************/
 
-static void igc_txclean(FAR struct igc_driver_s *priv)
+static void igc_txclean(FAR struct igc_queue_s *q)
 {
+  FAR struct igc_driver_s       *priv   = q->priv;
   FAR struct netdev_lowerhalf_s *netdev = &priv->dev;
 
   /* Reset ring */
 
-  igc_putreg_mem(priv, IGC_TDH0, 0);
-  igc_putreg_mem(priv, IGC_TDT0, 0);
+  igc_putreg_mem(priv, IGC_TDH(q->qid), 0);
+  igc_putreg_mem(priv, IGC_TDT(q->qid), 0);
 
   /* Free any pending TX */
 
-  while (priv->tx_now != priv->tx_done)
+  while (q->tx_now != q->tx_done)
     {
       /* Free net packet */
 
-      netpkt_free(netdev, priv->tx_pkt[priv->tx_done], NETPKT_TX);
+      netpkt_free(netdev, q->tx_pkt[q->tx_done], NETPKT_TX);
 
       /* Next descriptor */
 
-      priv->tx_done = (priv->tx_done + 1) % IGC_TX_DESC;
+      q->tx_done = (q->tx_done + 1) % IGC_TX_DESC;
     }
 
-  priv->tx_now  = 0;
-  priv->tx_done = 0;
+  q->tx_now  = 0;
+  q->tx_done = 0;
 }
 
 /*****************************************************************************
@@ -484,7 +557,7 @@ static void igc_txclean(FAR struct igc_driver_s *priv)
  *   Clean receive ring
  *
  * Input Parameters:
- *   priv - Reference to the driver state structure
+ *   q - Reference to the queue state structure
  *
  * Returned Value:
  *   None
@@ -494,40 +567,43 @@ static void igc_txclean(FAR struct igc_driver_s *priv)
  *
  *****************************************************************************/
 
-static void igc_rxclean(FAR struct igc_driver_s *priv)
+static void igc_rxclean(FAR struct igc_queue_s *q)
 {
-  priv->rx_now = 0;
+  q->rx_now = 0;
 
-  igc_putreg_mem(priv, IGC_RDH0, 0);
-  igc_putreg_mem(priv, IGC_RDT0, IGC_RX_DESC - 1);
+  igc_putreg_mem(q->priv, IGC_RDH(q->qid), 0);
+  igc_putreg_mem(q->priv, IGC_RDT(q->qid), IGC_RX_DESC - 1);
 }
 
 /*****************************************************************************
- * Name: igc_transmit
+ * Name: igc_transmit_queue
  *
  * Description:
- *   Start hardware transmission.  Called either from the txdone interrupt
- *   handling or from watchdog based polling.
+ *   Start hardware transmission on the TX queue qid.  Called either from
+ *   the txdone interrupt handling or from watchdog based polling.
  *
  * Input Parameters:
- *   priv - Reference to the driver state structure
+ *   dev - Reference to the lower half driver structure
+ *   qid - The TX queue
+ *   pkt - The packet to send
  *
  * Returned Value:
- *   None
+ *   OK on success, a negated errno value on failure
  *
  * Assumptions:
  *   The network is locked.
  *
  *****************************************************************************/
 
-static int igc_transmit(FAR struct netdev_lowerhalf_s *dev,
-                          FAR netpkt_t *pkt)
+static int igc_transmit_queue(FAR struct netdev_lowerhalf_s *dev, int qid,
+                              FAR netpkt_t *pkt)
 {
   FAR struct igc_driver_s *priv    = (FAR struct igc_driver_s *)dev;
+  FAR struct igc_queue_s  *q       = &priv->queue[qid];
   uint64_t                 pa      = 0;
-  int                      desc    = priv->tx_now;
+  int                      desc    = q->tx_now;
   size_t                   len     = netpkt_getdatalen(dev, pkt);
-  size_t                   tx_next = (priv->tx_now + 1) % IGC_TX_DESC;
+  size_t                   tx_next = (q->tx_now + 1) % IGC_TX_DESC;
 
   ninfo("transmit\n");
 
@@ -546,35 +622,35 @@ static int igc_transmit(FAR struct netdev_lowerhalf_s *dev,
 
   /* Drop packet if ring full */
 
-  if (tx_next == priv->tx_done)
+  if (tx_next == q->tx_done)
     {
       return -ENOMEM;
     }
 
   /* Store TX packet reference */
 
-  priv->tx_pkt[priv->tx_now] = pkt;
+  q->tx_pkt[q->tx_now] = pkt;
 
   /* Prepare next TX descriptor */
 
-  priv->tx_now = tx_next;
+  q->tx_now = tx_next;
 
   /* Setup TX descriptor */
 
   pa = up_addrenv_va_to_pa(netpkt_getdata(dev, pkt));
 
-  priv->tx[desc].addr   = pa;
-  priv->tx[desc].len    = len;
-  priv->tx[desc].cmd    = (IGC_TDESC_CMD_EOP | IGC_TDESC_CMD_IFCS |
-                           IGC_TDESC_CMD_RS);
-  priv->tx[desc].cso    = 0;
-  priv->tx[desc].status = 0;
+  q->tx[desc].addr   = pa;
+  q->tx[desc].len    = len;
+  q->tx[desc].cmd    = (IGC_TDESC_CMD_EOP | IGC_TDESC_CMD_IFCS |
+                        IGC_TDESC_CMD_RS);
+  q->tx[desc].cso    = 0;
+  q->tx[desc].status = 0;
 
   UP_DSB();
 
   /* Update TX tail */
 
-  igc_putreg_mem(priv, IGC_TDT0, priv->tx_now);
+  igc_putreg_mem(priv, IGC_TDT(qid), q->tx_now);
 
   ninfodumpbuffer("Transmitted:", netpkt_getdata(dev, pkt), len);
 
@@ -582,35 +658,56 @@ static int igc_transmit(FAR struct netdev_lowerhalf_s *dev,
 }
 
 /*****************************************************************************
- * Name: igc_receive
+ * Name: igc_transmit
+ *
+ * Description:
+ *   Start hardware transmission on the only TX queue.
+ *
+ *****************************************************************************/
+
+#ifndef CONFIG_NETDEV_RSS
+static int igc_transmit(FAR struct netdev_lowerhalf_s *dev,
+                        FAR netpkt_t *pkt)
+{
+  return igc_transmit_queue(dev, 0, pkt);
+}
+#endif
+
+/*****************************************************************************
+ * Name: igc_receive_queue
  *
  * Description:
  *   An interrupt was received indicating the availability of a new RX packet
+ *   on the RX queue qid
  *
  * Input Parameters:
- *   priv - Reference to the driver state structure
+ *   dev - Reference to the lower half driver structure
+ *   qid - The RX queue
  *
  * Returned Value:
- *   None
+ *   The received packet, NULL if none
  *
  * Assumptions:
- *   The network is locked.
+ *   Only the state of queue qid is touched, the caller may not hold the
+ *   device lock.
  *
  *****************************************************************************/
 
-static FAR netpkt_t *igc_receive(FAR struct netdev_lowerhalf_s *dev)
+static FAR netpkt_t *igc_receive_queue(FAR struct netdev_lowerhalf_s *dev,
+                                       int qid)
 {
   FAR struct igc_driver_s *priv = (FAR struct igc_driver_s *)dev;
+  FAR struct igc_queue_s  *q    = &priv->queue[qid];
   FAR netpkt_t            *pkt  = NULL;
   FAR struct igc_rx_leg_s *rx   = NULL;
   int                      desc = 0;
 
-  desc = priv->rx_now;
+  desc = q->rx_now;
 
   /* Get RX descriptor and RX packet */
 
-  rx = &priv->rx[desc];
-  pkt = priv->rx_pkt[desc];
+  rx = &q->rx[desc];
+  pkt = q->rx_pkt[desc];
 
   /* Check if descriptor done */
 
@@ -621,12 +718,12 @@ static FAR netpkt_t *igc_receive(FAR struct netdev_lowerhalf_s *dev)
 
   /* Next descriptor */
 
-  priv->rx_now = (priv->rx_now + 1) % IGC_RX_DESC;
+  q->rx_now = (q->rx_now + 1) % IGC_RX_DESC;
 
   /* Allocate new rx packet */
 
-  priv->rx_pkt[desc] = netpkt_alloc(dev, NETPKT_RX);
-  if (priv->rx_pkt[desc] == NULL)
+  q->rx_pkt[desc] = netpkt_alloc(dev, NETPKT_RX);
+  if (q->rx_pkt[desc] == NULL)
     {
       nerr("alloc pkt_new failed\n");
       PANIC();
@@ -639,13 +736,13 @@ static FAR netpkt_t *igc_receive(FAR struct netdev_lowerhalf_s *dev)
   /* Store new packet in RX descriptor ring */
 
   rx->addr   = up_addrenv_va_to_pa(
-               netpkt_getdata(dev, priv->rx_pkt[desc]));
+               netpkt_getdata(dev, q->rx_pkt[desc]));
   rx->len    = 0;
   rx->status = 0;
 
   /* Update RX tail */
 
-  igc_putreg_mem(priv, IGC_RDT0, desc);
+  igc_putreg_mem(priv, IGC_RDT(qid), desc);
 
   /* Handle errors */
 
@@ -660,6 +757,21 @@ static FAR netpkt_t *igc_receive(FAR struct netdev_lowerhalf_s *dev)
   return pkt;
 }
 
+/*****************************************************************************
+ * Name: igc_receive
+ *
+ * Description:
+ *   Receive a packet from the only RX queue.
+ *
+ *****************************************************************************/
+
+#ifndef CONFIG_NETDEV_RSS
+static FAR netpkt_t *igc_receive(FAR struct netdev_lowerhalf_s *dev)
+{
+  return igc_receive_queue(dev, 0);
+}
+#endif
+
 /*****************************************************************************
  * Name: igc_txdone
  *
@@ -667,7 +779,7 @@ static FAR netpkt_t *igc_receive(FAR struct netdev_lowerhalf_s *dev)
  *   An interrupt was received indicating that the last TX packet(s) is done
  *
  * Input Parameters:
- *   priv - Reference to the driver state structure
+ *   q - Reference to the queue state structure
  *
  * Returned Value:
  *   None
@@ -677,35 +789,57 @@ static FAR netpkt_t *igc_receive(FAR struct netdev_lowerhalf_s *dev)
  *
  *****************************************************************************/
 
-static void igc_txdone(FAR struct netdev_lowerhalf_s *dev)
+static void igc_txdone(FAR struct igc_queue_s *q)
 {
-  FAR struct igc_driver_s *priv = (FAR struct igc_driver_s *)dev;
+  FAR struct netdev_lowerhalf_s *dev = &q->priv->dev;
 
-  while (priv->tx_now != priv->tx_done)
+  while (q->tx_now != q->tx_done)
     {
-      if (priv->tx[priv->tx_done].status == 0)
+      if (q->tx[q->tx_done].status == 0)
         {
           break;
         }
 
-      if (!(priv->tx[priv->tx_done].status & IGC_TDESC_STATUS_DD))
+      if (!(q->tx[q->tx_done].status & IGC_TDESC_STATUS_DD))
         {
-          nerr("tx failed: 0x%" PRIx32 "\n", priv->tx[priv->tx_done].status);
-          NETDEV_TXERRORS(&priv->dev.netdev);
+          nerr("tx failed: 0x%" PRIx32 "\n", q->tx[q->tx_done].status);
+          NETDEV_TXERRORS(&dev->netdev);
         }
 
       /* Free net packet */
 
-      netpkt_free(dev, priv->tx_pkt[priv->tx_done], NETPKT_TX);
+      netpkt_free(dev, q->tx_pkt[q->tx_done], NETPKT_TX);
 
       /* Next descriptor */
 
-      priv->tx_done = (priv->tx_done + 1) % IGC_TX_DESC;
+      q->tx_done = (q->tx_done + 1) % IGC_TX_DESC;
     }
 
   netdev_lower_txdone(dev);
 }
 
+/*****************************************************************************
+ * Name: igc_rxready
+ *
+ * Description:
+ *   Notify the upper half that all the RX queues are to be polled.
+ *
+ *****************************************************************************/
+
+static void igc_rxready(FAR struct igc_driver_s *priv)
+{
+#if IGC_NQUEUES > 1
+  int i;
+
+  for (i = 0; i < IGC_NQUEUES; i++)
+    {
+      netdev_lower_rxready_queue(&priv->dev, i);
+    }
+#else
+  netdev_lower_rxready(&priv->dev);
+#endif
+}
+
 /*****************************************************************************
  * Name: igc_link_work
  *
@@ -761,6 +895,7 @@ static void igc_msix_interrupt(FAR struct igc_driver_s *priv)
 {
   uint32_t icr  = 0;
   uint32_t eicr = 0;
+  int      i;
 
   /* Get interrupts */
 
@@ -780,7 +915,7 @@ static void igc_msix_interrupt(FAR struct igc_driver_s *priv)
 
   if (icr & IGC_IC_RXDW)
     {
-      netdev_lower_rxready(&priv->dev);
+      igc_rxready(priv);
     }
 
   /* Link Status Change */
@@ -802,14 +937,17 @@ static void igc_msix_interrupt(FAR struct igc_driver_s *priv)
   if (icr & IGC_IC_RXMISS)
     {
       nerr("Receiver Miss\n");
-      netdev_lower_rxready(&priv->dev);
+      igc_rxready(priv);
     }
 
   /* Transmit Descriptor Written Back */
 
   if (icr & IGC_IC_TXDW)
     {
-      igc_txdone(&priv->dev);
+      for (i = 0; i < IGC_NQUEUES; i++)
+        {
+          igc_txdone(&priv->queue[i]);
+        }
     }
 }
 
@@ -847,6 +985,37 @@ static int igc_interrupt(int irq, FAR void *context, FAR void *arg)
   return OK;
 }
 
+/*****************************************************************************
+ * Name: igc_queue_interrupt
+ *
+ * Description:
+ *   MSI-X interrupt handler of a queue pair.  The cause is cleared by the
+ *   hardware.
+ *
+ * Input Parameters:
+ *   irq     - Number of the IRQ that generated the interrupt
+ *   context - Interrupt register state save info (architecture-specific)
+ *   arg     - Reference to the queue state structure
+ *
+ * Returned Value:
+ *   OK on success
+ *
+ *****************************************************************************/
+
+#if IGC_NQUEUES > 1
+static int igc_queue_interrupt(int irq, FAR void *context, FAR void *arg)
+{
+  FAR struct igc_queue_s *q = (FAR struct igc_queue_s *)arg;
+
+  DEBUGASSERT(q != NULL);
+
+  igc_txdone(q);
+  netdev_lower_rxready_queue(&q->priv->dev, q->qid);
+
+  return OK;
+}
+#endif
+
 /*****************************************************************************
  * Name: igc_ifup
  *
@@ -1064,14 +1233,20 @@ static int igc_rmmac(FAR struct netdev_lowerhalf_s *dev,
 
 static void igc_disable(FAR struct igc_driver_s *priv)
 {
-  uint32_t regval;
-  int      i = 0;
+  FAR struct igc_queue_s *q;
+  uint32_t                regval;
+  int                     i = 0;
+  int                     j;
 
   /* Disable interrupts */
 
   igc_putreg_mem(priv, IGC_EIMC, IGC_MSIX_EIMS);
   igc_putreg_mem(priv, IGC_IMC, IGC_MSIX_IMS);
-  up_disable_irq(priv->irq);
+
+  for (i = 0; i < IGC_NVECTORS; i++)
+    {
+      up_disable_irq(priv->irq[i]);
+    }
 
   /* Disable Transmitter */
 
@@ -1089,19 +1264,24 @@ static void igc_disable(FAR struct igc_driver_s *priv)
 
   igc_putreg_mem(priv, IGC_CTRL, IGC_CTRL_DEVRST);
 
-  /* Reset Tx tail */
+  for (j = 0; j < IGC_NQUEUES; j++)
+    {
+      q = &priv->queue[j];
+
+      /* Reset Tx tail */
 
-  igc_txclean(priv);
+      igc_txclean(q);
 
-  /* Reset Rx tail */
+      /* Reset Rx tail */
 
-  igc_rxclean(priv);
+      igc_rxclean(q);
 
-  /* Free RX packets */
+      /* Free RX packets */
 
-  for (i = 0; i < IGC_RX_DESC; i += 1)
-    {
-      netpkt_free(&priv->dev, priv->rx_pkt[i], NETPKT_RX);
+      for (i = 0; i < IGC_RX_DESC; i += 1)
+        {
+          netpkt_free(&priv->dev, q->rx_pkt[i], NETPKT_RX);
+        }
     }
 }
 
@@ -1125,37 +1305,73 @@ static void igc_phy_reset(FAR struct igc_driver_s *priv)
 }
 
 /*****************************************************************************
- * Name: igc_enable
+ * Name: igc_rss_enable
  *
  * Description:
- *   Enable device.
+ *   Spread the received flows over the RX queues with the RSS hash.
  *
  *****************************************************************************/
 
-static void igc_enable(FAR struct igc_driver_s *priv)
+#if IGC_NQUEUES > 1
+static void igc_rss_enable(FAR struct igc_driver_s *priv)
 {
-  FAR struct netdev_lowerhalf_s *dev = (FAR struct netdev_lowerhalf_s *)priv;
-  uint64_t pa     = 0;
   uint32_t regval = 0;
   int      i      = 0;
 
-  /* Reset PHY */
+  /* Hash key, little endian in each register */
 
-  igc_phy_reset(priv);
+  for (i = 0; i < IGC_RSSRK_SIZE; i += 4)
+    {
+      regval = ((uint32_t)g_igc_rsskey[i] |
+                ((uint32_t)g_igc_rsskey[i + 1] << 8) |
+                ((uint32_t)g_igc_rsskey[i + 2] << 16) |
+                ((uint32_t)g_igc_rsskey[i + 3] << 24));
+      igc_putreg_mem(priv, IGC_RSSRK + i, regval);
+    }
 
-  /* Reset Multicast Table Array */
+  /* Redirection table, one queue index byte per entry */
 
-  for (i = 0; i < priv->type->mta_regs; i++)
+  for (i = 0; i < IGC_RETA_ENTRIES; i += 4)
     {
-      igc_putreg_mem(priv, IGC_MTA + (i << 2), 0);
+      regval = (((i + 0) % IGC_NQUEUES) |
+                (((i + 1) % IGC_NQUEUES) << 8) |
+                (((i + 2) % IGC_NQUEUES) << 16) |
+                (((i + 3) % IGC_NQUEUES) << 24));
+      igc_putreg_mem(priv, IGC_RETA + i, regval);
     }
 
+  /* Hash on the IP addresses and the TCP/UDP ports */
+
+  igc_putreg_mem(priv, IGC_MRQC,
+                 IGC_MRQC_ENABLE_RSS |
+                 IGC_MRQC_RSS_IPV4 | IGC_MRQC_RSS_IPV4_TCP |
+                 IGC_MRQC_RSS_IPV4_UDP | IGC_MRQC_RSS_IPV6 |
+                 IGC_MRQC_RSS_IPV6_TCP | IGC_MRQC_RSS_IPV6_UDP);
+}
+#endif
+
+/*****************************************************************************
+ * Name: igc_queue_enable
+ *
+ * Description:
+ *   Setup the descriptor rings of a queue pair.
+ *
+ *****************************************************************************/
+
+static void igc_queue_enable(FAR struct igc_queue_s *q)
+{
+  FAR struct igc_driver_s       *priv = q->priv;
+  FAR struct netdev_lowerhalf_s *dev  = &priv->dev;
+  uint64_t                       pa     = 0;
+  uint32_t                       regval = 0;
+  int                            i      = 0;
+
   /* Allocate RX packets */
 
   for (i = 0; i < IGC_RX_DESC; i += 1)
     {
-      priv->rx_pkt[i] = netpkt_alloc(dev, NETPKT_RX);
-      if (priv->rx_pkt[i] == NULL)
+      q->rx_pkt[i] = netpkt_alloc(dev, NETPKT_RX);
+      if (q->rx_pkt[i] == NULL)
         {
           nerr("alloc rx_pkt failed\n");
           PANIC();
@@ -1163,49 +1379,91 @@ static void igc_enable(FAR struct igc_driver_s *priv)
 
       /* Configure RX descriptor */
 
-      priv->rx[i].addr   = up_addrenv_va_to_pa(
-                           netpkt_getdata(dev, priv->rx_pkt[i]));
-      priv->rx[i].len    = 0;
-      priv->rx[i].status = 0;
+      q->rx[i].addr   = up_addrenv_va_to_pa(
+                        netpkt_getdata(dev, q->rx_pkt[i]));
+      q->rx[i].len    = 0;
+      q->rx[i].status = 0;
     }
 
   /* Setup TX descriptor */
 
   /* The address passed to the NIC must be physical */
 
-  pa = up_addrenv_va_to_pa(priv->tx);
+  pa = up_addrenv_va_to_pa(q->tx);
 
   regval = (uint32_t)pa;
-  igc_putreg_mem(priv, IGC_TDBAL0, regval);
+  igc_putreg_mem(priv, IGC_TDBAL(q->qid), regval);
   regval = (uint32_t)(pa >> 32);
-  igc_putreg_mem(priv, IGC_TDBAH0, regval);
+  igc_putreg_mem(priv, IGC_TDBAH(q->qid), regval);
 
   regval = IGC_TX_DESC * sizeof(struct igc_tx_leg_s);
-  igc_putreg_mem(priv, IGC_TDLEN0, regval);
+  igc_putreg_mem(priv, IGC_TDLEN(q->qid), regval);
 
   /* Reset TX tail */
 
-  igc_txclean(priv);
+  igc_txclean(q);
 
   /* Setup RX descriptor */
 
   /* The address passed to the NIC must be physical */
 
-  pa = up_addrenv_va_to_pa(priv->rx);
+  pa = up_addrenv_va_to_pa(q->rx);
 
   regval = (uint32_t)pa;
-  igc_putreg_mem(priv, IGC_RDBAL0, regval);
+  igc_putreg_mem(priv, IGC_RDBAL(q->qid), regval);
   regval = (uint32_t)(pa >> 32);
-  igc_putreg_mem(priv, IGC_RDBAH0, regval);
+  igc_putreg_mem(priv, IGC_RDBAH(q->qid), regval);
 
   regval = IGC_RX_DESC * sizeof(struct igc_rx_leg_s);
-  igc_putreg_mem(priv, IGC_RDLEN0, regval);
+  igc_putreg_mem(priv, IGC_RDLEN(q->qid), regval);
+}
+
+/*****************************************************************************
+ * Name: igc_enable
+ *
+ * Description:
+ *   Enable device.
+ *
+ *****************************************************************************/
+
+static void igc_enable(FAR struct igc_driver_s *priv)
+{
+  uint32_t regval = 0;
+  int      i      = 0;
+
+  /* Reset PHY */
+
+  igc_phy_reset(priv);
+
+  /* Reset Multicast Table Array */
+
+  for (i = 0; i < priv->type->mta_regs; i++)
+    {
+      igc_putreg_mem(priv, IGC_MTA + (i << 2), 0);
+    }
+
+  /* Setup descriptor rings */
+
+  for (i = 0; i < IGC_NQUEUES; i++)
+    {
+      igc_queue_enable(&priv->queue[i]);
+    }
+
+#if IGC_NQUEUES > 1
+  /* Setup receive side scaling */
+
+  igc_rss_enable(priv);
+#endif
 
   /* Enable interrupts */
 
   igc_putreg_mem(priv, IGC_EIMS, IGC_MSIX_EIMS);
   igc_putreg_mem(priv, IGC_IMS, IGC_MSIX_IMS);
-  up_enable_irq(priv->irq);
+
+  for (i = 0; i < IGC_NVECTORS; i++)
+    {
+      up_enable_irq(priv->irq[i]);
+    }
 
   /* Set link up */
 
@@ -1226,21 +1484,24 @@ static void igc_enable(FAR struct igc_driver_s *priv)
 #endif
   igc_putreg_mem(priv, IGC_RCTL, regval);
 
-  /* Enable TX queeu */
+  for (i = 0; i < IGC_NQUEUES; i++)
+    {
+      /* Enable TX queue */
 
-  regval = igc_getreg_mem(priv, IGC_TXDCTL0);
-  regval |= IGC_TXDCTL_ENABLE;
-  igc_putreg_mem(priv, IGC_TXDCTL0, regval);
+      regval = igc_getreg_mem(priv, IGC_TXDCTL(i));
+      regval |= IGC_TXDCTL_ENABLE;
+      igc_putreg_mem(priv, IGC_TXDCTL(i), regval);
 
-  /* Enable RX queue */
+      /* Enable RX queue */
 
-  regval = igc_getreg_mem(priv, IGC_RXDCTL0);
-  regval |= IGC_RXDCTL_ENABLE;
-  igc_putreg_mem(priv, IGC_RXDCTL0, regval);
+      regval = igc_getreg_mem(priv, IGC_RXDCTL(i));
+      regval |= IGC_RXDCTL_ENABLE;
+      igc_putreg_mem(priv, IGC_RXDCTL(i), regval);
 
-  /* Reset RX tail - after queue is enabled */
+      /* Reset RX tail - after queue is enabled */
 
-  igc_rxclean(priv);
+      igc_rxclean(&priv->queue[i]);
+    }
 
 #ifdef CONFIG_DEBUG_NET_INFO
   /* Dump memory */
@@ -1262,27 +1523,49 @@ static int igc_initialize(FAR struct igc_driver_s *priv)
   uint32_t regval = 0;
   uint64_t mac    = 0;
   int      ret    = OK;
+#if IGC_NQUEUES > 1
+  int      i      = 0;
+#endif
 
   /* Allocate MSI */
 
-  ret = pci_alloc_irq(priv->pcidev, &priv->irq, 1);
-  if (ret != 1)
+  ret = pci_alloc_irq(priv->pcidev, priv->irq, IGC_NVECTORS);
+  if (ret != IGC_NVECTORS)
     {
       nerr("Failed to allocate MSI %d\n", ret);
+      if (ret > 0)
+        {
+          pci_release_irq(priv->pcidev, priv->irq, ret);
+          ret = -ENOTSUP;
+        }
+
       return ret;
     }
 
   /* Attach IRQ */
 
-  irq_attach(priv->irq, igc_interrupt, priv);
+#if IGC_NQUEUES > 1
+  for (i = 0; i < IGC_NQUEUES; i++)
+    {
+      irq_attach(priv->irq[i], igc_queue_interrupt, &priv->queue[i]);
+
+      /* Service each queue pair on its own CPU */
+
+      up_affinity_irq(priv->irq[i], 1 << (i % CONFIG_SMP_NCPUS));
+    }
+
+  irq_attach(priv->irq[IGC_VECTOR_OTHER], igc_interrupt, priv);
+#else
+  irq_attach(priv->irq[0], igc_interrupt, priv);
+#endif
 
   /* Connect MSI */
 
-  ret = pci_connect_irq(priv->pcidev, &priv->irq, 1);
+  ret = pci_connect_irq(priv->pcidev, priv->irq, IGC_NVECTORS);
   if (ret != OK)
     {
       nerr("Failed to connect MSI %d\n", ret);
-      pci_release_irq(priv->pcidev, &priv->irq, 1);
+      pci_release_irq(priv->pcidev, priv->irq, IGC_NVECTORS);
 
       return -ENOTSUP;
     }
@@ -1294,12 +1577,32 @@ static int igc_initialize(FAR struct igc_driver_s *priv)
 
   /* Configure MSI-X */
 
+#if IGC_NQUEUES > 1
+  /* Queue pair i is serviced by vector i */
+
+  for (i = 0; i < IGC_NQUEUES; i++)
+    {
+      regval = igc_getreg_mem(priv, IGC_IVAR(i >> 1));
+      regval |= ((IGC_IVAR_VALID | i) << IGC_IVAR_RX_SHIFT(i)) |
+                ((IGC_IVAR_VALID | i) << IGC_IVAR_TX_SHIFT(i));
+      igc_putreg_mem(priv, IGC_IVAR(i >> 1), regval);
+    }
+
+  igc_putreg_mem(priv, IGC_IVARMSC, IGC_MSIX_IVARMSC);
+
+  /* Enable MSI-X Multiple Vectors */
+
+  igc_putreg_mem(priv, IGC_GPIE, IGC_MSIX_GPIE);
+  igc_putreg_mem(priv, IGC_EIAC, IGC_MSIX_EIAC);
+#else
   igc_putreg_mem(priv, IGC_IVAR0, IGC_MSIX_IVAR0);
   igc_putreg_mem(priv, IGC_IVARMSC, IGC_MSIX_IVARMSC);
 
   /* Enable MSI-X Single Vector */
 
-  igc_putreg_mem(priv, IGC_GPIE, IGC_GPIE_MSIX_SINGLE);
+  igc_putreg_mem(priv, IGC_GPIE, IGC_MSIX_GPIE);
+#endif
+
   igc_putreg_mem(priv, IGC_EIMS, IGC_MSIX_EIMS);
 
   /* Configure Other causes */
@@ -1308,7 +1611,14 @@ static int igc_initialize(FAR struct igc_driver_s *priv)
 
   /* Configure Interrupt Throttle */
 
+#if IGC_NQUEUES > 1
+  for (i = 0; i < IGC_NVECTORS; i++)
+    {
+      igc_putreg_mem(priv, IGC_EITR(i), (CONFIG_NET_IGC_INT_INTERVAL << 2));
+    }
+#else
   igc_putreg_mem(priv, IGC_EITR0, (CONFIG_NET_IGC_INT_INTERVAL << 2));
+#endif
 
   /* Get MAC if valid */
 
@@ -1340,7 +1650,9 @@ static int igc_probe(FAR struct pci_device_s *dev)
   FAR const struct igc_type_s   *type   = NULL;
   FAR struct igc_driver_s       *priv   = NULL;
   FAR struct netdev_lowerhalf_s *netdev = NULL;
+  FAR struct igc_queue_s        *q      = NULL;
   int                            ret    = -ENOMEM;
+  int                            i      = 0;
 
   /* Get type data associated with this PCI device card */
 
@@ -1363,42 +1675,49 @@ static int igc_probe(FAR struct pci_device_s *dev)
 
   priv->pcidev = dev;
 
-  /* Allocate TX descriptors */
-
-  priv->tx = kmm_memalign(type->desc_align,
-                          IGC_TX_DESC * sizeof(struct igc_tx_leg_s));
-  if (priv->tx == NULL)
+  for (i = 0; i < IGC_NQUEUES; i++)
     {
-      nerr("alloc tx failed %d\n", errno);
-      goto errout;
-    }
+      q       = &priv->queue[i];
+      q->priv = priv;
+      q->qid  = i;
 
-  /* Allocate RX descriptors */
+      /* Allocate TX descriptors */
 
-  priv->rx = kmm_memalign(type->desc_align,
-                          IGC_RX_DESC * sizeof(struct igc_rx_leg_s));
-  if (priv->rx == NULL)
-    {
-      nerr("alloc rx failed %d\n", errno);
-      goto errout;
-    }
+      q->tx = kmm_memalign(type->desc_align,
+                           IGC_TX_DESC * sizeof(struct igc_tx_leg_s));
+      if (q->tx == NULL)
+        {
+          nerr("alloc tx failed %d\n", errno);
+          goto errout;
+        }
 
-  /* Allocate TX packet pointer array */
+      /* Allocate RX descriptors */
 
-  priv->tx_pkt = kmm_zalloc(IGC_TX_DESC * sizeof(netpkt_t *));
-  if (priv->tx_pkt == NULL)
-    {
-      nerr("alloc tx_pkt failed\n");
-      goto errout;
-    }
+      q->rx = kmm_memalign(type->desc_align,
+                           IGC_RX_DESC * sizeof(struct igc_rx_leg_s));
+      if (q->rx == NULL)
+        {
+          nerr("alloc rx failed %d\n", errno);
+          goto errout;
+        }
 
-  /* Allocate RX packet pointer array */
+      /* Allocate TX packet pointer array */
 
-  priv->rx_pkt = kmm_zalloc(IGC_RX_DESC * sizeof(netpkt_t *));
-  if (priv->rx_pkt == NULL)
-    {
-      nerr("alloc rx_pkt failed\n");
-      goto errout;
+      q->tx_pkt = kmm_zalloc(IGC_TX_DESC * sizeof(netpkt_t *));
+      if (q->tx_pkt == NULL)
+        {
+          nerr("alloc tx_pkt failed\n");
+          goto errout;
+        }
+
+      /* Allocate RX packet pointer array */
+
+      q->rx_pkt = kmm_zalloc(IGC_RX_DESC * sizeof(netpkt_t *));
+      if (q->rx_pkt == NULL)
+        {
+          nerr("alloc rx_pkt failed\n");
+          goto errout;
+        }
     }
 
 #ifdef CONFIG_NET_MCASTGROUP
@@ -1444,15 +1763,29 @@ static int igc_probe(FAR struct pci_device_s *dev)
 
   /* Register the network device */
 
-  netdev->quota[NETPKT_TX] = IGC_TX_QUOTA;
-  netdev->quota[NETPKT_RX] = IGC_RX_QUOTA;
+  netdev->quota[NETPKT_TX] = IGC_TX_QUOTA * IGC_NQUEUES;
+  netdev->quota[NETPKT_RX] = IGC_RX_QUOTA * IGC_NQUEUES;
   netdev->ops = &g_igc_ops;
 
+#ifdef CONFIG_NETDEV_RSS
+  netdev->nqueues = IGC_NQUEUES;
+#  if IGC_NQUEUES > 1
+  netdev->rxtype   = NETDEV_RX_THREAD_RSS;
+  netdev->priority = CONFIG_NET_IGC_PRIORITY;
+#  endif
+#endif
+
   return netdev_lower_register(netdev, NET_LL_ETHERNET);
 
 errout:
-  kmm_free(priv->tx);
-  kmm_free(priv->rx);
+  for (i = 0; i < IGC_NQUEUES; i++)
+    {
+      kmm_free(priv->queue[i].tx);
+      kmm_free(priv->queue[i].rx);
+      kmm_free(priv->queue[i].tx_pkt);
+      kmm_free(priv->queue[i].rx_pkt);
+    }
+
 #ifdef CONFIG_NET_MCASTGROUP
   kmm_free(priv->mta);
 #endif
@@ -139,6 +139,29 @@
 #define IGC_TDWBAL0               (0xe038)   /* Transmit Descriptor WB Address Low Queue */
 #define IGC_TDWBAH0               (0xe03c)   /* Transmit Descriptor WB Address High Queue */
 
+/* Per queue registers, the registers of queue n follow those of queue n-1
+ * at 0x40 bytes.
+ */
+
+#define IGC_QUEUE_OFFSET(n)       (0x40 * (n))
+#define IGC_RDBAL(n)              (IGC_RDBAL0 + IGC_QUEUE_OFFSET(n))
+#define IGC_RDBAH(n)              (IGC_RDBAH0 + IGC_QUEUE_OFFSET(n))
+#define IGC_RDLEN(n)              (IGC_RDLEN0 + IGC_QUEUE_OFFSET(n))
+#define IGC_RDH(n)                (IGC_RDH0 + IGC_QUEUE_OFFSET(n))
+#define IGC_RDT(n)                (IGC_RDT0 + IGC_QUEUE_OFFSET(n))
+#define IGC_RXDCTL(n)             (IGC_RXDCTL0 + IGC_QUEUE_OFFSET(n))
+#define IGC_TDBAL(n)              (IGC_TDBAL0 + IGC_QUEUE_OFFSET(n))
+#define IGC_TDBAH(n)              (IGC_TDBAH0 + IGC_QUEUE_OFFSET(n))
+#define IGC_TDLEN(n)              (IGC_TDLEN0 + IGC_QUEUE_OFFSET(n))
+#define IGC_TDH(n)                (IGC_TDH0 + IGC_QUEUE_OFFSET(n))
+#define IGC_TDT(n)                (IGC_TDT0 + IGC_QUEUE_OFFSET(n))
+#define IGC_TXDCTL(n)             (IGC_TXDCTL0 + IGC_QUEUE_OFFSET(n))
+
+/* Per vector interrupt registers */
+
+#define IGC_IVAR(n)               (IGC_IVAR0 + ((n) << 2))  /* Queues 2n and 2n+1 */
+#define IGC_EITR(n)               (IGC_EITR0 + ((n) << 2))
+
 /* Transmit Scheduling Registers */
 
 #define IGC_TQAVHC                (0x300c)   /* Transmit Qav High Credits */
@@ -425,6 +448,12 @@
 #define IGC_IVAR0_TXQ0_SHIFT      (8)        /* Bits 8-12: MSI-X vector assigned to TxQ0 */
 #define IGC_IVAR0_TXQ0_VAL        (1 << 7)   /* Bit 7: Valid bit for TxQ0 */
 
+/* Interrupt Vector Allocation Registers, queue q in IGC_IVAR(q >> 1) */
+
+#define IGC_IVAR_RX_SHIFT(q)      (((q) & 1) << 4)        /* MSI-X vector of RxQq */
+#define IGC_IVAR_TX_SHIFT(q)      ((((q) & 1) << 4) + 8)  /* MSI-X vector of TxQq */
+#define IGC_IVAR_VALID            (1 << 7)                /* Valid bit, above the vector */
+
 /* Interrupt Vector Allocation Registers - Misc */
 
 #define IGC_IVARMSC_TCPTIM        (0)        /* Bits 0-5: MSI-X vectorassigned to TCP timer interrupt */
@@ -446,6 +475,21 @@
 #define IGC_GPIE_EIAME            (1 << 30)  /* Bit 30: Extended Interrupt Auto Mask Enable */
 #define IGC_GPIE_PBASUPPORT       (1 << 31)  /* Bit 31: PBA Support */
 
+/* Multiple Receive Queues Command */
+
+#define IGC_MRQC_ENABLE_RSS       (2 << 0)   /* Bits 0-2: RSS enabled */
+#define IGC_MRQC_RSS_IPV4_TCP     (1 << 16)  /* Bit 16: Hash TCP/IPv4 */
+#define IGC_MRQC_RSS_IPV4         (1 << 17)  /* Bit 17: Hash IPv4 */
+#define IGC_MRQC_RSS_IPV6         (1 << 20)  /* Bit 20: Hash IPv6 */
+#define IGC_MRQC_RSS_IPV6_TCP     (1 << 21)  /* Bit 21: Hash TCP/IPv6 */
+#define IGC_MRQC_RSS_IPV4_UDP     (1 << 22)  /* Bit 22: Hash UDP/IPv4 */
+#define IGC_MRQC_RSS_IPV6_UDP     (1 << 23)  /* Bit 23: Hash UDP/IPv6 */
+
+/* Redirection Table and RSS Random Key */
+
+#define IGC_RETA_ENTRIES          (128)      /* 8-bit queue index per entry */
+#define IGC_RSSRK_SIZE            (40)       /* Key size in bytes */
+
 /* Transmit Descriptor Command Field */
 
 #define IGC_TDESC_CMD_EOP         (1 << 0)   /* Bit 0: End Of Packet */
@@ -39,6 +39,7 @@
 #include <nuttx/net/net.h>
 #include <nuttx/net/netdev_lowerhalf.h>
 #include <nuttx/net/pkt.h>
+#include <nuttx/net/tcp.h>
 #include <nuttx/net/vlan.h>
 #include <nuttx/semaphore.h>
 #include <nuttx/spinlock.h>
@@ -51,6 +52,10 @@
 
 #define NETDEV_THREAD_NAME_FMT "netdev-%s"
 
+#define NETDEV_QUEUE_ALL   -1 /* Poll all RX queues of the lower half */
+
+#define NETDEV_RX_BATCH    16 /* Frames taken from one queue per lock */
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -88,6 +93,19 @@ struct netdev_upperhalf_s
 
   bool txing;
 
+#ifdef CONFIG_NETDEV_GSO
+  bool tso;                  /* Lower half cuts TSO frames itself */
+#endif
+
+#ifdef CONFIG_NETDEV_GRO
+  /* Frame being merged by GRO within one RX poll */
+
+  FAR netpkt_t *gro;         /* Head frame, NULL if none */
+  uint16_t gro_sum;          /* Sum of the merged TCP payloads */
+  uint16_t gro_mss;          /* Payload length of the first segment */
+  uint8_t gro_nseg;          /* Number of merged segments */
+#endif
+
   /* Deferring process to work queue or thread */
 
   union
@@ -255,6 +273,338 @@ static inline bool netdev_upper_can_tx(FAR struct netdev_upperhalf_s *upper)
   return quota > 0;
 }
 
+/****************************************************************************
+ * Name: netdev_upper_nthreads
+ *
+ * Description:
+ *   Get the number of dedicated threads of the lower half: none in work
+ *   queue or direct mode, one in thread mode.  In RSS mode, one per queue
+ *   for multi-queue lower halves, otherwise one per CPU.
+ *
+ ****************************************************************************/
+
+static int netdev_upper_nthreads(FAR struct netdev_lowerhalf_s *lower)
+{
+  switch (lower->rxtype)
+    {
+      case NETDEV_RX_THREAD:
+        return 1;
+
+      case NETDEV_RX_THREAD_RSS:
+#ifdef CONFIG_NETDEV_RSS
+        if (lower->ops->receive_queue != NULL)
+          {
+            return lower->nqueues;
+          }
+#endif
+
+        return CONFIG_SMP_NCPUS;
+
+      default:
+        return 0;
+    }
+}
+
+/****************************************************************************
+ * Name: netdev_upper_flowhash
+ *
+ * Description:
+ *   Hash the addresses and ports of an outgoing IP packet, so that all the
+ *   packets of a flow are given to the same TX queue.  The hash is the
+ *   same in both directions of the flow.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NETDEV_RSS
+static uint32_t netdev_upper_flowhash(FAR netpkt_t *pkt)
+{
+  FAR const uint8_t *l3 = IOB_DATA(pkt);
+  FAR const uint8_t *l4 = NULL;
+  uint32_t hash;
+  uint8_t proto;
+#ifdef CONFIG_NET_IPv6
+  int i;
+#endif
+
+  switch (l3[0] >> 4)
+    {
+#ifdef CONFIG_NET_IPv4
+      case 4:
+        {
+          FAR const struct ipv4_hdr_s *ipv4 =
+            (FAR const struct ipv4_hdr_s *)l3;
+
+          hash  = net_ip4addr_conv32(ipv4->srcipaddr) ^
+                  net_ip4addr_conv32(ipv4->destipaddr);
+          proto = ipv4->proto;
+
+          /* Fragments carry no ports, leave them out for all fragments of
+           * a datagram to hash the same.
+           */
+
+          if ((ipv4->ipoffset[0] & 0x3f) == 0 && ipv4->ipoffset[1] == 0)
+            {
+              l4 = l3 + ((ipv4->vhl & IPv4_HLMASK) << 2);
+            }
+        }
+        break;
+#endif
+
+#ifdef CONFIG_NET_IPv6
+      case 6:
+        {
+          FAR const struct ipv6_hdr_s *ipv6 =
+            (FAR const struct ipv6_hdr_s *)l3;
+
+          hash = 0;
+          for (i = 0; i < 8; i += 2)
+            {
+              hash ^= ((uint32_t)(ipv6->srcipaddr[i] ^
+                                  ipv6->destipaddr[i]) << 16) |
+                      (ipv6->srcipaddr[i + 1] ^ ipv6->destipaddr[i + 1]);
+            }
+
+          proto = ipv6->proto;
+          l4    = l3 + IPv6_HDRLEN;
+        }
+        break;
+#endif
+
+      default:
+        return 0;
+    }
+
+  if (l4 != NULL && (proto == IP_PROTO_TCP || proto == IP_PROTO_UDP) &&
+      l4 + 4 <= IOB_DATA(pkt) + pkt->io_len)
+    {
+      hash ^= ((uint32_t)l4[0] << 8 | l4[1]) ^
+              ((uint32_t)l4[2] << 8 | l4[3]);
+    }
+
+  hash ^= proto;
+
+  /* Mix the bits (murmur3 finalizer), the queue is taken from the low
+   * bits.
+   */
+
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6b;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35;
+  hash ^= hash >> 16;
+
+  return hash;
+}
+#endif
+
+/****************************************************************************
+ * Name: netdev_upper_transmit
+ *
+ * Description:
+ *   Give a packet to the lower half, on the TX queue of its flow for
+ *   multi-queue lower halves.
+ *
+ * Assumptions:
+ *   Called with the network locked.
+ *
+ ****************************************************************************/
+
+static int netdev_upper_transmit(FAR struct netdev_lowerhalf_s *lower,
+                                 FAR netpkt_t *pkt)
+{
+#ifdef CONFIG_NETDEV_RSS
+  if (lower->ops->transmit_queue != NULL)
+    {
+      return lower->ops->transmit_queue(lower,
+                          netdev_upper_flowhash(pkt) % lower->nqueues, pkt);
+    }
+#endif
+
+  return lower->ops->transmit(lower, pkt);
+}
+
+/****************************************************************************
+ * Name: netdev_upper_tcp_hdrsum
+ *
+ * Description:
+ *   Sum the IPv4 pseudo-header and the TCP header of a segment, as the
+ *   first part of the TCP checksum.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_NETDEV_GSO) || defined(CONFIG_NETDEV_GRO)
+static uint16_t netdev_upper_tcp_hdrsum(FAR struct ipv4_hdr_s *ipv4,
+                                        FAR struct tcp_hdr_s *tcp,
+                                        uint16_t tcplen)
+{
+  uint16_t sum = tcplen + IP_PROTO_TCP;
+
+  sum = chksum(sum, (FAR uint8_t *)ipv4->srcipaddr, 2 * sizeof(in_addr_t));
+  return chksum(sum, (FAR uint8_t *)tcp, (tcp->tcpoffset >> 4) << 2);
+}
+#endif
+
+/****************************************************************************
+ * Name: netdev_upper_is_tso
+ *
+ * Description:
+ *   Check if an oversized TX frame is a TCP/IPv4 super-frame that is to be
+ *   cut at the MTU.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NETDEV_TSO
+static bool netdev_upper_is_tso(FAR struct net_driver_s *dev,
+                                FAR netpkt_t *pkt)
+{
+  FAR struct ipv4_hdr_s *ipv4 = (FAR struct ipv4_hdr_s *)IOB_DATA(pkt);
+
+  return (dev->d_features & NETDEV_TX_TSO) != 0 &&
+         (ipv4->vhl >> 4) == 4 && ipv4->proto == IP_PROTO_TCP;
+}
+#endif
+
+/****************************************************************************
+ * Name: netdev_upper_gso
+ *
+ * Description:
+ *   Cut a TCP/IPv4 super-frame at the MTU in software and send the
+ *   segments, for lower halves without hardware TSO.
+ *
+ * Input Parameters:
+ *   dev - Reference to the NuttX driver state structure
+ *   pkt - The super-frame, always consumed
+ *
+ * Returned Value:
+ *   Negated errno value - Error number that occurs.
+ *   NETDEV_TX_CONTINUE  - Driver can send more, continue the poll.
+ *
+ * Assumptions:
+ *   Called with the network locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NETDEV_GSO
+static int netdev_upper_gso(FAR struct net_driver_s *dev, FAR netpkt_t *pkt)
+{
+  FAR struct netdev_upperhalf_s *upper = dev->d_private;
+  FAR struct netdev_lowerhalf_s *lower = upper->lower;
+  FAR struct ipv4_hdr_s *ipv4 = (FAR struct ipv4_hdr_s *)IOB_DATA(pkt);
+  FAR struct tcp_hdr_s *tcp;
+  FAR netpkt_t *seg;
+  unsigned int iphdrlen;
+  unsigned int hdrlen;
+  unsigned int total;
+  unsigned int seglen;
+  unsigned int off;
+  uint32_t seq;
+  uint16_t ipid;
+  uint16_t mss;
+  uint8_t flags;
+  int ret = OK;
+
+  iphdrlen = (ipv4->vhl & IPv4_HLMASK) << 2;
+  tcp      = (FAR struct tcp_hdr_s *)((FAR uint8_t *)ipv4 + iphdrlen);
+  hdrlen   = iphdrlen + ((tcp->tcpoffset >> 4) << 2);
+  total    = pkt->io_pktlen - hdrlen;
+  mss      = NETDEV_PKTSIZE(dev) - NET_LL_HDRLEN(dev) - hdrlen;
+  flags    = tcp->flags;
+  ipid     = ((uint16_t)ipv4->ipid[0] << 8) | ipv4->ipid[1];
+
+  DEBUGASSERT(pkt->io_len >= hdrlen);
+
+  memcpy(&seq, tcp->seqno, sizeof(seq));
+  seq = NTOHL(seq);
+
+  for (off = 0; off < total; off += seglen)
+    {
+      FAR struct ipv4_hdr_s *sipv4;
+      FAR struct tcp_hdr_s *stcp;
+      uint32_t sseq;
+      uint16_t sum;
+
+      seglen = MIN(total - off, mss);
+
+      seg = iob_tryalloc(false);
+      if (seg == NULL)
+        {
+          ret = -ENOMEM;
+          break;
+        }
+
+      iob_reserve(seg, CONFIG_NET_LL_GUARDSIZE);
+
+      /* Copy the L2, IP and TCP headers, then the payload of the segment */
+
+      ret = netpkt_copyin(lower, seg, netpkt_getdata(lower, pkt),
+                          NET_LL_HDRLEN(dev) + hdrlen, 0);
+      if (ret >= 0)
+        {
+          ret = iob_clone_partial(pkt, seglen, hdrlen + off, seg, hdrlen,
+                                  false, false);
+        }
+
+      if (ret < 0)
+        {
+          iob_free_chain(seg);
+          break;
+        }
+
+      sipv4 = (FAR struct ipv4_hdr_s *)IOB_DATA(seg);
+      stcp  = (FAR struct tcp_hdr_s *)((FAR uint8_t *)sipv4 + iphdrlen);
+
+      sipv4->len[0]   = (hdrlen + seglen) >> 8;
+      sipv4->len[1]   = (hdrlen + seglen) & 0xff;
+      sipv4->ipid[0]  = ipid >> 8;
+      sipv4->ipid[1]  = ipid & 0xff;
+      sipv4->ipchksum = 0;
+      sipv4->ipchksum = ~ipv4_chksum(sipv4);
+      ipid++;
+
+      sseq = HTONL(seq + off);
+      memcpy(stcp->seqno, &sseq, sizeof(sseq));
+
+      /* FIN and PSH belong to the last segment only */
+
+      if (off + seglen < total)
+        {
+          stcp->flags = flags & ~(TCP_FIN | TCP_PSH);
+        }
+
+      stcp->tcpchksum = 0;
+      if ((dev->d_features & NETDEV_TX_CSUM) == 0)
+        {
+          sum = netdev_upper_tcp_hdrsum(sipv4, stcp,
+                                        hdrlen - iphdrlen + seglen);
+          sum = chksum_iob(sum, seg, hdrlen);
+          stcp->tcpchksum = ~((sum == 0) ? 0xffff : HTONS(sum));
+        }
+
+      /* The segment is returned through netpkt_free() like any TX packet */
+
+      atomic_fetch_sub(&lower->quota_ptr[NETPKT_TX], 1);
+
+      ret = netdev_upper_transmit(lower, seg);
+      if (ret < 0)
+        {
+          netpkt_free(lower, seg, NETPKT_TX);
+          break;
+        }
+    }
+
+  netpkt_free(lower, pkt, NETPKT_TX);
+
+  if (ret < 0)
+    {
+      NETDEV_TXERRORS(dev);
+      nerr("ERROR: Segmentation failed: %d\n", ret);
+      return ret;
+    }
+
+  return NETDEV_TX_CONTINUE;
+}
+#endif
+
 /****************************************************************************
  * Name: netdev_upper_txpoll
  *
@@ -299,14 +649,29 @@ static int netdev_upper_txpoll(FAR struct net_driver_s *dev)
 
   pkt = netpkt_get(dev, NETPKT_TX);
 
-  if (netpkt_getdatalen(lower, pkt) > NETDEV_PKTSIZE(dev))
+  if (netpkt_getdatalen(lower, pkt) <= NETDEV_PKTSIZE(dev))
     {
-      nerr("ERROR: Packet too long to send!\n");
-      ret = -EMSGSIZE;
+      ret = netdev_upper_transmit(lower, pkt);
+    }
+#ifdef CONFIG_NETDEV_TSO
+  else if (netdev_upper_is_tso(dev, pkt))
+    {
+#  ifdef CONFIG_NETDEV_GSO
+      if (!upper->tso)
+        {
+          /* The lower half cannot cut the frame, do it here */
+
+          return netdev_upper_gso(dev, pkt);
+        }
+#  endif
+
+      ret = netdev_upper_transmit(lower, pkt);
     }
+#endif
   else
     {
-      ret = lower->ops->transmit(lower, pkt);
+      nerr("ERROR: Packet too long to send!\n");
+      ret = -EMSGSIZE;
     }
 
   if (ret != OK)
@@ -688,107 +1053,493 @@ static void ip_input(FAR struct net_driver_s *dev)
 #endif
 
 /****************************************************************************
- * Function: netdev_upper_rxpoll_work
+ * Name: netdev_upper_input
  *
  * Description:
- *   Try to receive packets from device and pass packets into IP
- *   stack and send packets which is from IP stack if necessary.
+ *   Pass one received packet into the network stack.
  *
  * Input Parameters:
- *   upper - Reference to the upper half driver structure
+ *   dev - Reference to the NuttX driver state structure
+ *   pkt - The received packet
  *
  * Assumptions:
  *   Called with the network locked.
  *
  ****************************************************************************/
 
-static void netdev_upper_rxpoll_work(FAR struct netdev_upperhalf_s *upper)
+static void netdev_upper_input(FAR struct net_driver_s *dev,
+                               FAR netpkt_t *pkt)
 {
-  FAR struct netdev_lowerhalf_s *lower = upper->lower;
-  FAR struct net_driver_s       *dev   = &lower->netdev;
-  FAR netpkt_t                  *pkt;
-
-  /* Loop while receive() successfully retrieves valid Ethernet frames. */
-
-  netdev_lock(dev);
-  while ((pkt = lower->ops->receive(lower)) != NULL)
-    {
-      if (!IFF_IS_UP(dev->d_flags))
-        {
-          /* Interface down, drop frame */
-
-          NETDEV_RXDROPPED(dev);
-          netpkt_free(lower, pkt, NETPKT_RX);
-          nerr("ERROR: Dropped frame due to lower dev not up\n");
-          continue;
-        }
-
-      netpkt_put(dev, pkt, NETPKT_RX);
-      NETDEV_RXPACKETS(dev);
+  netpkt_put(dev, pkt, NETPKT_RX);
+  NETDEV_RXPACKETS(dev);
 
 #ifdef CONFIG_NET_PKT
-      /* When packet sockets are enabled, feed the frame into the tap */
+  /* When packet sockets are enabled, feed the frame into the tap */
 
-      pkt_input(dev);
+  pkt_input(dev);
 #endif
 
-      switch (dev->d_lltype)
-        {
+  switch (dev->d_lltype)
+    {
 #ifdef CONFIG_NET_LOOPBACK
-        case NET_LL_LOOPBACK:
+    case NET_LL_LOOPBACK:
 #endif
 #ifdef CONFIG_NET_ETHERNET
-        case NET_LL_ETHERNET:
+    case NET_LL_ETHERNET:
 #endif
 #ifdef CONFIG_DRIVERS_IEEE80211
-        case NET_LL_IEEE80211:
+    case NET_LL_IEEE80211:
 #endif
 #if defined(CONFIG_NET_LOOPBACK) || defined(CONFIG_NET_ETHERNET) || \
     defined(CONFIG_DRIVERS_IEEE80211)
-          eth_input(dev);
-          break;
+      eth_input(dev);
+      break;
 #endif
 #ifdef CONFIG_NET_MBIM
-        case NET_LL_MBIM:
-          ip_input(dev);
-          break;
+    case NET_LL_MBIM:
+      ip_input(dev);
+      break;
 #endif
 #ifdef CONFIG_NET_CAN
-        case NET_LL_CAN:
-          ninfo("CAN frame");
-          can_input(dev);
-          break;
+    case NET_LL_CAN:
+      ninfo("CAN frame");
+      can_input(dev);
+      break;
 #endif
-        default:
-          nerr("Unknown link type %d\n", dev->d_lltype);
-          break;
+    default:
+      nerr("Unknown link type %d\n", dev->d_lltype);
+      break;
+    }
+}
+
+#ifdef CONFIG_NETDEV_GRO
+/****************************************************************************
+ * Name: netdev_upper_gro_parse
+ *
+ * Description:
+ *   Check if a received frame may be merged by GRO: a TCP/IPv4 segment for
+ *   this host with a valid IP header checksum, carrying data with only ACK
+ *   (and PSH) set, whose headers are in the first buffer.
+ *
+ * Returned Value:
+ *   The TCP payload length, or zero if the frame cannot be merged.
+ *
+ ****************************************************************************/
+
+static unsigned int netdev_upper_gro_parse(FAR struct net_driver_s *dev,
+                                           FAR netpkt_t *pkt)
+{
+  FAR struct eth_hdr_s *eth =
+    (FAR struct eth_hdr_s *)(IOB_DATA(pkt) - ETH_HDRLEN);
+  FAR struct ipv4_hdr_s *ipv4 = (FAR struct ipv4_hdr_s *)IOB_DATA(pkt);
+  FAR struct tcp_hdr_s *tcp = (FAR struct tcp_hdr_s *)(ipv4 + 1);
+  unsigned int hdrlen;
+  unsigned int iplen;
+
+  if (dev->d_lltype != NET_LL_ETHERNET ||
+      eth->type != HTONS(ETHTYPE_IP) ||
+      pkt->io_len < IPv4_HDRLEN + TCP_HDRLEN ||
+      ipv4->vhl != 0x45 || ipv4->proto != IP_PROTO_TCP ||
+      (ipv4->ipoffset[0] & 0x3f) != 0 || ipv4->ipoffset[1] != 0 ||
+      net_ip4addr_conv32(ipv4->destipaddr) != dev->d_ipaddr ||
+      (tcp->flags & ~TCP_PSH) != TCP_ACK)
+    {
+      return 0;
+    }
+
+  hdrlen = IPv4_HDRLEN + ((tcp->tcpoffset >> 4) << 2);
+  iplen  = ((unsigned int)ipv4->len[0] << 8) | ipv4->len[1];
+
+  if (pkt->io_len < hdrlen || iplen != pkt->io_pktlen || iplen <= hdrlen)
+    {
+      return 0;
+    }
+
+  /* The IP header checksum of a merged frame is recomputed, so a header
+   * that fails it must be left to the stack to drop.
+   */
+
+  if (ipv4_chksum(ipv4) != 0xffff)
+    {
+      return 0;
+    }
+
+  return iplen - hdrlen;
+}
+
+/****************************************************************************
+ * Name: netdev_upper_gro_match
+ *
+ * Description:
+ *   Check if a segment continues the frame being merged: same flow and
+ *   headers, next in sequence, and not beyond the size limits.
+ *
+ ****************************************************************************/
+
+static bool netdev_upper_gro_match(FAR struct netdev_upperhalf_s *upper,
+                                   FAR netpkt_t *pkt, unsigned int len)
+{
+  FAR netpkt_t *head = upper->gro;
+  FAR struct ipv4_hdr_s *hipv4 = (FAR struct ipv4_hdr_s *)IOB_DATA(head);
+  FAR struct ipv4_hdr_s *ipv4 = (FAR struct ipv4_hdr_s *)IOB_DATA(pkt);
+  FAR struct tcp_hdr_s *htcp = (FAR struct tcp_hdr_s *)(hipv4 + 1);
+  FAR struct tcp_hdr_s *tcp = (FAR struct tcp_hdr_s *)(ipv4 + 1);
+  unsigned int hlen;
+  uint32_t hseq;
+  uint32_t seq;
+
+  hlen = head->io_pktlen - IPv4_HDRLEN - ((htcp->tcpoffset >> 4) << 2);
+
+  if ((hlen & 1) != 0 || len > upper->gro_mss ||
+      hlen + len > CONFIG_NETDEV_GRO_MAXSIZE ||
+      (htcp->flags & TCP_PSH) != 0 ||
+      htcp->tcpoffset != tcp->tcpoffset)
+    {
+      return false;
+    }
+
+  /* Same addresses, ports, ACK, window and options */
+
+  if (memcmp(IOB_DATA(head) - ETH_HDRLEN, IOB_DATA(pkt) - ETH_HDRLEN,
+             2 * ETHER_ADDR_LEN) != 0 ||
+      hipv4->tos != ipv4->tos || hipv4->ttl != ipv4->ttl ||
+      memcmp(hipv4->srcipaddr, ipv4->srcipaddr,
+             2 * sizeof(in_addr_t)) != 0 ||
+      htcp->srcport != tcp->srcport || htcp->destport != tcp->destport ||
+      memcmp(htcp->ackno, tcp->ackno, sizeof(tcp->ackno)) != 0 ||
+      memcmp(htcp->wnd, tcp->wnd, sizeof(tcp->wnd)) != 0 ||
+      memcmp(htcp->optdata, tcp->optdata,
+             ((tcp->tcpoffset >> 4) << 2) - TCP_HDRLEN) != 0)
+    {
+      return false;
+    }
+
+  memcpy(&hseq, htcp->seqno, sizeof(hseq));
+  memcpy(&seq, tcp->seqno, sizeof(seq));
+  return NTOHL(hseq) + hlen == NTOHL(seq);
+}
+
+/****************************************************************************
+ * Name: netdev_upper_gro_flush
+ *
+ * Description:
+ *   Pass the frame being merged into the network stack.  The checksums are
+ *   rebuilt for the merged frame: the TCP one from the payload sums of the
+ *   segments, which were derived from their own checksums, so the stack
+ *   still detects a corrupted segment.
+ *
+ ****************************************************************************/
+
+static void netdev_upper_gro_flush(FAR struct netdev_upperhalf_s *upper)
+{
+  FAR struct net_driver_s *dev = &upper->lower->netdev;
+  FAR netpkt_t *head = upper->gro;
+  FAR struct ipv4_hdr_s *ipv4;
+  FAR struct tcp_hdr_s *tcp;
+  uint32_t sum;
+
+  if (head == NULL)
+    {
+      return;
+    }
+
+  upper->gro = NULL;
+
+  if (upper->gro_nseg > 1)
+    {
+      ipv4 = (FAR struct ipv4_hdr_s *)IOB_DATA(head);
+      tcp  = (FAR struct tcp_hdr_s *)(ipv4 + 1);
+
+      ipv4->len[0]   = head->io_pktlen >> 8;
+      ipv4->len[1]   = head->io_pktlen & 0xff;
+      ipv4->ipchksum = 0;
+      ipv4->ipchksum = ~ipv4_chksum(ipv4);
+
+      tcp->tcpchksum = 0;
+      sum  = netdev_upper_tcp_hdrsum(ipv4, tcp,
+                                     head->io_pktlen - IPv4_HDRLEN);
+      sum += upper->gro_sum;
+      sum  = (sum & 0xffff) + (sum >> 16);
+      tcp->tcpchksum = ~((sum == 0) ? 0xffff : HTONS((uint16_t)sum));
+    }
+
+  netdev_upper_input(dev, head);
+}
+
+/****************************************************************************
+ * Name: netdev_upper_gro_receive
+ *
+ * Description:
+ *   Merge a received frame into the pending one if possible, otherwise
+ *   flush the pending frame and start over from this one.
+ *
+ * Assumptions:
+ *   Called with the network locked.
+ *
+ ****************************************************************************/
+
+static void netdev_upper_gro_receive(FAR struct netdev_upperhalf_s *upper,
+                                     FAR netpkt_t *pkt)
+{
+  FAR struct netdev_lowerhalf_s *lower = upper->lower;
+  FAR struct net_driver_s *dev = &lower->netdev;
+  FAR struct ipv4_hdr_s *ipv4 = (FAR struct ipv4_hdr_s *)IOB_DATA(pkt);
+  FAR struct tcp_hdr_s *tcp = (FAR struct tcp_hdr_s *)(ipv4 + 1);
+  unsigned int hdrlen;
+  unsigned int len;
+  uint32_t sum;
+
+  len = netdev_upper_gro_parse(dev, pkt);
+  if (len > 0 && upper->gro != NULL &&
+      netdev_upper_gro_match(upper, pkt, len))
+    {
+      FAR struct ipv4_hdr_s *hipv4 =
+        (FAR struct ipv4_hdr_s *)IOB_DATA(upper->gro);
+      FAR struct tcp_hdr_s *htcp = (FAR struct tcp_hdr_s *)(hipv4 + 1);
+
+      hdrlen = IPv4_HDRLEN + ((tcp->tcpoffset >> 4) << 2);
+
+      /* Sum of each payload, from its segment checksum being valid */
+
+      if (upper->gro_nseg == 1)
+        {
+          upper->gro_sum = ~netdev_upper_tcp_hdrsum(hipv4, htcp,
+                              upper->gro->io_pktlen - IPv4_HDRLEN);
+        }
+
+      sum  = upper->gro_sum;
+      sum += (uint16_t)~netdev_upper_tcp_hdrsum(ipv4, tcp,
+                                                 pkt->io_pktlen -
+                                                 IPv4_HDRLEN);
+      upper->gro_sum = (sum & 0xffff) + (sum >> 16);
+      upper->gro_nseg++;
+
+      htcp->flags |= tcp->flags & TCP_PSH;
+
+      /* Append the payload, the quota of the segment is returned now */
+
+      iob_concat(upper->gro, iob_trimhead(pkt, hdrlen));
+      atomic_fetch_add(&lower->quota_ptr[NETPKT_RX], 1);
+      NETDEV_RXPACKETS(dev);
+
+      if (len < upper->gro_mss || (tcp->flags & TCP_PSH) != 0 ||
+          upper->gro->io_pktlen - hdrlen + upper->gro_mss >
+          CONFIG_NETDEV_GRO_MAXSIZE)
+        {
+          netdev_upper_gro_flush(upper);
+        }
+
+      return;
+    }
+
+  netdev_upper_gro_flush(upper);
+
+  if (len > 0 && (tcp->flags & TCP_PSH) == 0)
+    {
+      upper->gro      = pkt;
+      upper->gro_mss  = len;
+      upper->gro_nseg = 1;
+    }
+  else
+    {
+      netdev_upper_input(dev, pkt);
+    }
+}
+#endif /* CONFIG_NETDEV_GRO */
+
+/****************************************************************************
+ * Name: netdev_upper_receive
+ *
+ * Description:
+ *   Get the next received packet from the RX queue qid of the lower half,
+ *   or from any of its queues if qid is NETDEV_QUEUE_ALL.
+ *
+ * Assumptions:
+ *   Called with the device locked, except when polling a single queue of a
+ *   multi-queue lower half.
+ *
+ ****************************************************************************/
+
+static FAR netpkt_t *
+netdev_upper_receive(FAR struct netdev_lowerhalf_s *lower, int qid)
+{
+#ifdef CONFIG_NETDEV_RSS
+  FAR netpkt_t *pkt = NULL;
+
+  if (lower->ops->receive_queue != NULL)
+    {
+      if (qid != NETDEV_QUEUE_ALL)
+        {
+          return lower->ops->receive_queue(lower, qid);
         }
+
+      for (qid = 0; qid < lower->nqueues && pkt == NULL; qid++)
+        {
+          pkt = lower->ops->receive_queue(lower, qid);
+        }
+
+      return pkt;
+    }
+#endif
+
+  return lower->ops->receive(lower);
+}
+
+/****************************************************************************
+ * Name: netdev_upper_rxinput
+ *
+ * Description:
+ *   Pass one received packet into the network stack, or into GRO.
+ *
+ * Assumptions:
+ *   Called with the device locked.
+ *
+ ****************************************************************************/
+
+static void netdev_upper_rxinput(FAR struct netdev_upperhalf_s *upper,
+                                 FAR netpkt_t *pkt)
+{
+  FAR struct netdev_lowerhalf_s *lower = upper->lower;
+  FAR struct net_driver_s       *dev   = &lower->netdev;
+
+  if (!IFF_IS_UP(dev->d_flags))
+    {
+      /* Interface down, drop frame */
+
+      NETDEV_RXDROPPED(dev);
+      netpkt_free(lower, pkt, NETPKT_RX);
+      nerr("ERROR: Dropped frame due to lower dev not up\n");
+      return;
     }
 
+#ifdef CONFIG_NETDEV_GRO
+  if ((dev->d_features & NETDEV_RX_GRO) != 0)
+    {
+      netdev_upper_gro_receive(upper, pkt);
+      return;
+    }
+#endif
+
+  netdev_upper_input(dev, pkt);
+}
+
+/****************************************************************************
+ * Function: netdev_upper_rxpoll_work
+ *
+ * Description:
+ *   Try to receive packets from device and pass packets into IP
+ *   stack and send packets which is from IP stack if necessary.
+ *
+ *   A single queue of a multi-queue lower half has only one poller, so its
+ *   frames are taken from the lower half without the device lock, in
+ *   batches of up to NETDEV_RX_BATCH.  Only the protocol input of each
+ *   batch is serialized with the other queues.
+ *
+ * Input Parameters:
+ *   upper - Reference to the upper half driver structure
+ *   qid   - The RX queue to poll, NETDEV_QUEUE_ALL for all of them
+ *
+ ****************************************************************************/
+
+static void netdev_upper_rxpoll_work(FAR struct netdev_upperhalf_s *upper,
+                                     int qid)
+{
+  FAR struct netdev_lowerhalf_s *lower = upper->lower;
+  FAR struct net_driver_s       *dev   = &lower->netdev;
+  FAR netpkt_t                  *pkt;
+#ifdef CONFIG_NETDEV_RSS
+  FAR netpkt_t                  *batch[NETDEV_RX_BATCH];
+  int                            nbatch;
+  int                            i;
+
+  if (qid != NETDEV_QUEUE_ALL && lower->ops->receive_queue != NULL)
+    {
+      do
+        {
+          for (nbatch = 0; nbatch < NETDEV_RX_BATCH; nbatch++)
+            {
+              batch[nbatch] = lower->ops->receive_queue(lower, qid);
+              if (batch[nbatch] == NULL)
+                {
+                  break;
+                }
+            }
+
+          if (nbatch > 0)
+            {
+              netdev_lock(dev);
+              for (i = 0; i < nbatch; i++)
+                {
+                  netdev_upper_rxinput(upper, batch[i]);
+                }
+
+#ifdef CONFIG_NETDEV_GRO
+              /* Never hold a frame across batches */
+
+              netdev_upper_gro_flush(upper);
+#endif
+              netdev_unlock(dev);
+            }
+        }
+      while (nbatch == NETDEV_RX_BATCH);
+
+      return;
+    }
+#endif
+
+  /* Loop while receive() successfully retrieves valid Ethernet frames. */
+
+  netdev_lock(dev);
+  while ((pkt = netdev_upper_receive(lower, qid)) != NULL)
+    {
+      netdev_upper_rxinput(upper, pkt);
+    }
+
+#ifdef CONFIG_NETDEV_GRO
+  /* Never hold a frame across polls */
+
+  netdev_upper_gro_flush(upper);
+#endif
+
   netdev_unlock(dev);
 }
 
 /****************************************************************************
- * Name: netdev_upper_work
+ * Name: netdev_upper_poll
  *
  * Description:
  *   Perform an out-of-cycle poll on a dedicated thread or the worker thread.
  *
  * Input Parameters:
- *   arg - Reference to the upper half driver structure (cast to void *)
+ *   upper - Reference to the upper half driver structure
+ *   qid   - The RX queue to poll, NETDEV_QUEUE_ALL for all of them
  *
  ****************************************************************************/
 
-static void netdev_upper_work(FAR void *arg)
+static void netdev_upper_poll(FAR struct netdev_upperhalf_s *upper, int qid)
 {
-  FAR struct netdev_upperhalf_s *upper = arg;
-
   /* RX may release quota and driver buffer, so do RX first. */
 
-  netdev_upper_rxpoll_work(upper);
+  netdev_upper_rxpoll_work(upper, qid);
   netdev_upper_txavail_work(upper);
 }
 
+/****************************************************************************
+ * Name: netdev_upper_work
+ *
+ * Description:
+ *   Perform an out-of-cycle poll on the worker thread.
+ *
+ * Input Parameters:
+ *   arg - Reference to the upper half driver structure (cast to void *)
+ *
+ ****************************************************************************/
+
+static void netdev_upper_work(FAR void *arg)
+{
+  netdev_upper_poll(arg, NETDEV_QUEUE_ALL);
+}
+
 /****************************************************************************
  * Name: netdev_upper_loop
  *
@@ -801,21 +1552,31 @@ static int netdev_upper_loop(int argc, FAR char *argv[])
 {
   FAR struct netdev_upperhalf_s *upper =
     (FAR struct netdev_upperhalf_s *)((uintptr_t)strtoul(argv[1], NULL, 16));
-  int cpu = atoi(argv[2]);
-  FAR struct netdev_thread_s *t = &upper->thread[cpu];
+  int index = atoi(argv[2]);
+  FAR struct netdev_thread_s *t = &upper->thread[index];
+  int qid = NETDEV_QUEUE_ALL;
 
   if (upper->lower->rxtype == NETDEV_RX_THREAD_RSS)
     {
       cpu_set_t cpuset;
 
       CPU_ZERO(&cpuset);
-      CPU_SET(cpu, &cpuset);
+      CPU_SET(index % CONFIG_SMP_NCPUS, &cpuset);
       sched_setaffinity(t->tid, sizeof(cpu_set_t), &cpuset);
+
+#ifdef CONFIG_NETDEV_RSS
+      /* In multi-queue mode, each thread serves its own RX queue */
+
+      if (upper->lower->ops->receive_queue != NULL)
+        {
+          qid = index;
+        }
+#endif
     }
 
   while (nxsem_wait(&t->sem) == OK && t->tid != INVALID_PROCESS_ID)
     {
-      netdev_upper_work(upper);
+      netdev_upper_poll(upper, qid);
     }
 
   nwarn("WARNING: Netdev work thread quitting.");
@@ -823,6 +1584,24 @@ static int netdev_upper_loop(int argc, FAR char *argv[])
   return 0;
 }
 
+/****************************************************************************
+ * Name: netdev_upper_wake_thread
+ *
+ * Description:
+ *   Wake up a dedicated thread, if it is not already woken up.
+ *
+ ****************************************************************************/
+
+static void netdev_upper_wake_thread(FAR struct netdev_thread_s *t)
+{
+  int semcount;
+
+  if (nxsem_get_value(&t->sem, &semcount) == OK && semcount <= 0)
+    {
+      nxsem_post(&t->sem);
+    }
+}
+
 /****************************************************************************
  * Name: netdev_upper_queue_work
  *
@@ -837,7 +1616,6 @@ static int netdev_upper_loop(int argc, FAR char *argv[])
 static inline void netdev_upper_queue_work(FAR struct net_driver_s *dev)
 {
   FAR struct netdev_upperhalf_s *upper = dev->d_private;
-  int cpu = 0;
 
   switch (upper->lower->rxtype)
     {
@@ -853,18 +1631,12 @@ static inline void netdev_upper_queue_work(FAR struct net_driver_s *dev)
             }
         }
         break;
-      case NETDEV_RX_THREAD_RSS:
-        cpu = this_cpu();
       case NETDEV_RX_THREAD:
-        {
-          FAR struct netdev_thread_s *t = &upper->thread[cpu];
-          int semcount;
-
-          if (nxsem_get_value(&t->sem, &semcount) == OK && semcount <= 0)
-            {
-              nxsem_post(&t->sem);
-            }
-        }
+        netdev_upper_wake_thread(&upper->thread[0]);
+        break;
+      case NETDEV_RX_THREAD_RSS:
+        netdev_upper_wake_thread(&upper->thread[this_cpu() %
+                                 netdev_upper_nthreads(upper->lower)]);
         break;
     }
 }
@@ -1173,27 +1945,20 @@ int netdev_upper_vlan_ioctl(FAR struct netdev_lowerhalf_s *lower,
 
 static void netdev_upper_exit_thread(FAR struct netdev_upperhalf_s *upper)
 {
-  int cpu = 1;
+  int index = netdev_upper_nthreads(upper->lower);
 
-  switch (upper->lower->rxtype)
+  while (--index >= 0)
     {
-      case NETDEV_RX_THREAD_RSS:
-        cpu = CONFIG_SMP_NCPUS;
-      case NETDEV_RX_THREAD:
-        while (--cpu >= 0)
-          {
-            FAR struct netdev_thread_s *t = &upper->thread[cpu];
+      FAR struct netdev_thread_s *t = &upper->thread[index];
 
-            if (t->tid >= 0)
-              {
-                /* Try to tear down the dedicated thread for work. */
+      if (t->tid >= 0)
+        {
+          /* Try to tear down the dedicated thread for work. */
 
-                t->tid = INVALID_PROCESS_ID;
-                nxsem_post(&t->sem);
-                nxsem_wait(&t->sem_exit);
-              }
-          }
-        break;
+          t->tid = INVALID_PROCESS_ID;
+          nxsem_post(&t->sem);
+          nxsem_wait(&t->sem_exit);
+        }
     }
 }
 
@@ -1208,44 +1973,36 @@ static void netdev_upper_exit_thread(FAR struct netdev_upperhalf_s *upper)
 static int netdev_upper_ifup(FAR struct net_driver_s *dev)
 {
   FAR struct netdev_upperhalf_s *upper = dev->d_private;
-  int cpu = 1;
+  int index = netdev_upper_nthreads(upper->lower);
 
-  switch (upper->lower->rxtype)
+  /* Try to bring up the dedicated threads for work. */
+
+  while (--index >= 0)
     {
-      case NETDEV_RX_THREAD_RSS:
-        cpu = CONFIG_SMP_NCPUS;
-      case NETDEV_RX_THREAD:
+      FAR struct netdev_thread_s *t = &upper->thread[index];
+      FAR char *argv[3];
+      char      arg1[32];
+      char      arg2[32];
+      char      name[32];
 
-        /* Try to bring up a dedicated thread for work. */
+      snprintf(arg1, sizeof(arg1), "%p", upper);
+      argv[0] = arg1;
 
-        while (--cpu >= 0)
-          {
-            FAR struct netdev_thread_s *t = &upper->thread[cpu];
-            FAR char *argv[3];
-            char      arg1[32];
-            char      arg2[32];
-            char      name[32];
-
-            snprintf(arg1, sizeof(arg1), "%p", upper);
-            argv[0] = arg1;
-
-            snprintf(arg2, sizeof(arg2), "%d", cpu);
-            argv[1] = arg2;
-            argv[2] = NULL;
-
-            snprintf(name, sizeof(name), NETDEV_THREAD_NAME_FMT,
-                     dev->d_ifname);
-
-            t->tid = kthread_create(name, upper->lower->priority,
-                                    CONFIG_DEFAULT_TASK_STACKSIZE,
-                                    netdev_upper_loop, argv);
-            if (t->tid < 0)
-              {
-                netdev_upper_exit_thread(upper);
-                return t->tid;
-              }
-          }
-        break;
+      snprintf(arg2, sizeof(arg2), "%d", index);
+      argv[1] = arg2;
+      argv[2] = NULL;
+
+      snprintf(name, sizeof(name), NETDEV_THREAD_NAME_FMT,
+               dev->d_ifname);
+
+      t->tid = kthread_create(name, upper->lower->priority,
+                              CONFIG_DEFAULT_TASK_STACKSIZE,
+                              netdev_upper_loop, argv);
+      if (t->tid < 0)
+        {
+          netdev_upper_exit_thread(upper);
+          return t->tid;
+        }
     }
 
   if (upper->lower->ops->ifup)
@@ -1371,11 +2128,19 @@ int netdev_lower_register(FAR struct netdev_lowerhalf_s *dev,
 {
   FAR struct netdev_upperhalf_s *upper;
   size_t extra_size;
-  int cpu = 0;
+  int index;
   int ret;
 
   if (dev == NULL || dev->ops == NULL ||
-      dev->ops->transmit == NULL || dev->ops->receive == NULL)
+#ifdef CONFIG_NETDEV_RSS
+      (dev->ops->transmit_queue == NULL && dev->ops->transmit == NULL) ||
+      (dev->ops->receive_queue == NULL && dev->ops->receive == NULL) ||
+      ((dev->ops->transmit_queue != NULL ||
+        dev->ops->receive_queue != NULL) && dev->nqueues == 0)
+#else
+      dev->ops->transmit == NULL || dev->ops->receive == NULL
+#endif
+     )
     {
       nerr("ERROR: Invalid lower half device\n");
       return -EINVAL;
@@ -1400,12 +2165,9 @@ int netdev_lower_register(FAR struct netdev_lowerhalf_s *dev,
         extra_size = 0; /* No extra size needed for direct mode */
         break;
       case NETDEV_RX_THREAD:
-        extra_size = sizeof(struct netdev_thread_s);
-        cpu = 1;
-        break;
       case NETDEV_RX_THREAD_RSS:
-        extra_size = sizeof(struct netdev_thread_s) * CONFIG_SMP_NCPUS;
-        cpu = CONFIG_SMP_NCPUS;
+        extra_size = sizeof(struct netdev_thread_s) *
+                     netdev_upper_nthreads(dev);
         break;
       default:
         nerr("ERROR: Unrecognized device rxtype: %d\n", dev->rxtype);
@@ -1419,6 +2181,15 @@ int netdev_lower_register(FAR struct netdev_lowerhalf_s *dev,
 
   upper->txing = false;
 
+#ifdef CONFIG_NETDEV_GSO
+  /* Remember whether the lower half cuts TSO frames in hardware, the upper
+   * half does it for the others.
+   */
+
+  upper->tso = (dev->netdev.d_features & NETDEV_TX_TSO) != 0;
+  dev->netdev.d_features |= NETDEV_TX_TSO;
+#endif
+
   dev->netdev.d_ifup    = netdev_upper_ifup;
   dev->netdev.d_ifdown  = netdev_upper_ifdown;
   dev->netdev.d_txavail = netdev_upper_txavail;
@@ -1439,9 +2210,10 @@ int netdev_lower_register(FAR struct netdev_lowerhalf_s *dev,
       dev->netdev.d_private = NULL;
     }
 
-  while (--cpu >= 0)
+  index = netdev_upper_nthreads(dev);
+  while (--index >= 0)
     {
-      FAR struct netdev_thread_s *t = &upper->thread[cpu];
+      FAR struct netdev_thread_s *t = &upper->thread[index];
 
       t->tid = INVALID_PROCESS_ID;
       nxsem_init(&t->sem, 0, 0);
@@ -1468,7 +2240,7 @@ int netdev_lower_register(FAR struct netdev_lowerhalf_s *dev,
 int netdev_lower_unregister(FAR struct netdev_lowerhalf_s *dev)
 {
   FAR struct netdev_upperhalf_s *upper;
-  int cpu = 1;
+  int index;
   int ret;
 
   if (dev == NULL || dev->netdev.d_private == NULL)
@@ -1489,23 +2261,17 @@ int netdev_lower_unregister(FAR struct netdev_lowerhalf_s *dev)
       return ret;
     }
 
-  switch (dev->rxtype)
-    {
-      case NETDEV_RX_THREAD_RSS:
-        cpu = CONFIG_SMP_NCPUS;
-      case NETDEV_RX_THREAD:
+  /* Stop the dedicated threads for network operations in thread mode */
 
-        /* Stop the dedicated thread for network operations in thread mode */
+  netdev_upper_exit_thread(upper);
 
-        netdev_upper_exit_thread(upper);
-        while (--cpu >= 0)
-          {
-            FAR struct netdev_thread_s *t = &upper->thread[cpu];
+  index = netdev_upper_nthreads(dev);
+  while (--index >= 0)
+    {
+      FAR struct netdev_thread_s *t = &upper->thread[index];
 
-            nxsem_destroy(&t->sem);
-            nxsem_destroy(&t->sem_exit);
-          }
-        break;
+      nxsem_destroy(&t->sem);
+      nxsem_destroy(&t->sem_exit);
     }
 
 #if CONFIG_IOB_NCHAINS > 0
@@ -1585,14 +2351,68 @@ void netdev_lower_rxready(FAR struct netdev_lowerhalf_s *dev)
 
   if (dev->rxtype == NETDEV_RX_DIRECT)
     {
-      netdev_upper_rxpoll_work(dev->netdev.d_private);
+      netdev_upper_rxpoll_work(dev->netdev.d_private, NETDEV_QUEUE_ALL);
     }
+#ifdef CONFIG_NETDEV_RSS
+  else if (dev->rxtype == NETDEV_RX_THREAD_RSS &&
+           dev->ops->receive_queue != NULL)
+    {
+      FAR struct netdev_upperhalf_s *upper = dev->netdev.d_private;
+      int qid;
+
+      /* Each thread only polls its own RX queue and the lower half did not
+       * say which one is ready, so wake them all.
+       */
+
+      for (qid = 0; qid < dev->nqueues; qid++)
+        {
+          netdev_upper_wake_thread(&upper->thread[qid]);
+        }
+    }
+#endif
   else
     {
       netdev_upper_queue_work(&dev->netdev);
     }
 }
 
+/****************************************************************************
+ * Name: netdev_lower_rxready_queue
+ *
+ * Description:
+ *   Notifies the networking layer about an RX packet is ready to read on
+ *   the RX queue qid.
+ *
+ * Input Parameters:
+ *   dev - The lower half device driver structure
+ *   qid - The RX queue
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NETDEV_RSS
+void netdev_lower_rxready_queue(FAR struct netdev_lowerhalf_s *dev,
+                                int qid)
+{
+  FAR struct netdev_upperhalf_s *upper = dev->netdev.d_private;
+
+  DEBUGASSERT(qid >= 0 && qid < dev->nqueues);
+
+  if (dev->rxtype == NETDEV_RX_THREAD_RSS &&
+      dev->ops->receive_queue != NULL)
+    {
+      netdev_upper_wake_thread(&upper->thread[qid]);
+    }
+  else if (dev->rxtype == NETDEV_RX_DIRECT)
+    {
+      netdev_upper_rxpoll_work(upper, qid);
+    }
+  else
+    {
+      netdev_upper_queue_work(&dev->netdev);
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: netdev_lower_txdone
  *
@@ -30,10 +30,12 @@
 #include <string.h>
 #include <stdlib.h>
 
+#include <nuttx/arch.h>
 #include <nuttx/compiler.h>
 #include <nuttx/kmalloc.h>
 #include <nuttx/net/ip.h>
 #include <nuttx/net/netdev_lowerhalf.h>
+#include <nuttx/net/tcp.h>
 #include <nuttx/virtio/virtio.h>
 #include <nuttx/net/wifi_sim.h>
 
@@ -45,7 +47,26 @@
 
 /* Virtio net feature bits */
 
-#define VIRTIO_NET_F_MAC      5
+#define VIRTIO_NET_F_CSUM       0
+#define VIRTIO_NET_F_MAC        5
+#define VIRTIO_NET_F_HOST_TSO4  11
+#define VIRTIO_NET_F_CTRL_VQ    17
+#define VIRTIO_NET_F_MQ         22
+
+/* Virtio net control commands */
+
+#define VIRTIO_NET_CTRL_MQ              4
+#define VIRTIO_NET_CTRL_MQ_VQ_PAIRS_SET 0
+#define VIRTIO_NET_OK                   0
+
+/* Control command timeout, in 10 us polls */
+
+#define VIRTIO_NET_CTRL_RETRY           10000
+
+/* Virtio net header flags and GSO types */
+
+#define VIRTIO_NET_HDR_F_NEEDS_CSUM  1
+#define VIRTIO_NET_HDR_GSO_TCPV4     1
 
 /* Virtio net header size and packet buffer size */
 
@@ -53,23 +74,49 @@
 #define VIRTIO_NET_LLHDRSIZE  (sizeof(struct virtio_net_llhdr_s))
 #define VIRTIO_NET_BUFSIZE    (CONFIG_NET_ETH_PKTSIZE + CONFIG_NET_GUARDSIZE)
 
-/* Virtio net virtqueue index and number */
+/* Virtio net virtqueue index and number, queue pair q uses the virtqueues
+ * VIRTIO_NET_NUM * q + VIRTIO_NET_RX/TX.  The control virtqueue comes after
+ * all the queue pairs of the device.
+ */
 
 #define VIRTIO_NET_RX         0
 #define VIRTIO_NET_TX         1
 #define VIRTIO_NET_NUM        2
 
+#define VIRTIO_NET_VQ(q, dir) (VIRTIO_NET_NUM * (q) + (dir))
+#define VIRTIO_NET_VQ_DIR(id) ((id) % VIRTIO_NET_NUM)
+#define VIRTIO_NET_VQ_QID(id) ((id) / VIRTIO_NET_NUM)
+
+#ifdef CONFIG_NETDEV_RSS
+#  define VIRTIO_NET_NQUEUES  CONFIG_DRIVERS_VIRTIO_NET_QUEUES
+#else
+#  define VIRTIO_NET_NQUEUES  1
+#endif
+
 #define VIRTIO_NET_MAX_PKT_SIZE \
     ((CONFIG_NET_LL_GUARDSIZE - ETH_HDRLEN) + VIRTIO_NET_BUFSIZE)
 #define VIRTIO_NET_MAX_NIOB \
     ((VIRTIO_NET_MAX_PKT_SIZE + CONFIG_IOB_BUFSIZE - 1) / CONFIG_IOB_BUFSIZE)
 
+/* TX buffers may carry a TSO super-frame */
+
+#ifdef CONFIG_NETDEV_TSO
+#  define VIRTIO_NET_TX_BUFSIZE \
+     (VIRTIO_NET_BUFSIZE + CONFIG_NETDEV_TSO_MAXSIZE)
+#  define VIRTIO_NET_TX_MAX_NIOB \
+     ((VIRTIO_NET_MAX_PKT_SIZE + CONFIG_NETDEV_TSO_MAXSIZE + \
+       CONFIG_IOB_BUFSIZE - 1) / CONFIG_IOB_BUFSIZE)
+#else
+#  define VIRTIO_NET_TX_BUFSIZE  VIRTIO_NET_BUFSIZE
+#  define VIRTIO_NET_TX_MAX_NIOB VIRTIO_NET_MAX_NIOB
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
-/* Virtio net header, just define it here for further, now only use it
- * to calculate the virto net header size, see marco VIRTIO_NET_HDRSIZE
+/* Virtio net header, used to calculate the virtio net header size, see
+ * macro VIRTIO_NET_HDRSIZE, and to request TSO of a TX frame.
  */
 
 begin_packed_struct struct virtio_net_hdr_s
@@ -100,6 +147,16 @@ begin_packed_struct struct virtio_net_config_s
   uint32_t supported_hash_types;
 } end_packed_struct;
 
+/* Virtio net control command, the device writes the ack */
+
+begin_packed_struct struct virtio_net_ctrl_s
+{
+  uint8_t  class;
+  uint8_t  cmd;
+  uint16_t pairs;                            /* VIRTIO_NET_CTRL_MQ */
+  uint8_t  ack;
+} end_packed_struct;
+
 struct virtio_net_priv_s
 {
 #ifdef CONFIG_DRIVERS_WIFI_SIM
@@ -113,12 +170,27 @@ struct virtio_net_priv_s
   struct netdev_lowerhalf_s lower;     /* The netdev lowerhalf */
 #endif
 
-  spinlock_t                lock[VIRTIO_NET_NUM];
+  spinlock_t                lock[VIRTIO_NET_NUM * VIRTIO_NET_NQUEUES];
 
   /* Virtio device information */
 
   FAR struct virtio_device *vdev;      /* Virtio device pointer */
   int                       bufnum;    /* TX and RX Buffer number */
+  int                       nqueues;   /* Queue pairs in use */
+
+  /* RX buffers posted to each RX virtqueue, bounded by bufnum so that one
+   * queue cannot take the RX quota of the others.
+   */
+
+  int                       rxnum[VIRTIO_NET_NQUEUES];
+
+#if VIRTIO_NET_NQUEUES > 1
+  /* The control command is kept here rather than on the stack; the device
+   * may still write the ack after the driver gave up waiting for it.
+   */
+
+  struct virtio_net_ctrl_s  ctrl;
+#endif
 };
 
 /* Virtio Link Layer Header, follow shows the iob buffer layout:
@@ -152,9 +224,15 @@ static_assert(CONFIG_NET_LL_GUARDSIZE >= VIRTIO_NET_LLHDRSIZE + ETH_HDRLEN,
 
 static int virtio_net_ifup(FAR struct netdev_lowerhalf_s *dev);
 static int virtio_net_ifdown(FAR struct netdev_lowerhalf_s *dev);
+static int virtio_net_send_queue(FAR struct netdev_lowerhalf_s *dev,
+                                 int qid, FAR netpkt_t *pkt);
+static netpkt_t *virtio_net_recv_queue(FAR struct netdev_lowerhalf_s *dev,
+                                       int qid);
+#ifndef CONFIG_NETDEV_RSS
 static int virtio_net_send(FAR struct netdev_lowerhalf_s *dev,
                            FAR netpkt_t *pkt);
 static netpkt_t *virtio_net_recv(FAR struct netdev_lowerhalf_s *dev);
+#endif
 #ifdef CONFIG_NET_MCASTGROUP
 static int virtio_net_addmac(FAR struct netdev_lowerhalf_s *dev,
                              FAR const uint8_t *mac);
@@ -186,8 +264,15 @@ static const struct netdev_ops_s g_virtio_net_ops =
 {
   virtio_net_ifup,
   virtio_net_ifdown,
+#ifdef CONFIG_NETDEV_RSS
+  NULL,
+  NULL,
+  virtio_net_send_queue,
+  virtio_net_recv_queue,
+#else
   virtio_net_send,
   virtio_net_recv,
+#endif
 #ifdef CONFIG_NET_MCASTGROUP
   virtio_net_addmac,
   virtio_net_rmmac,
@@ -206,6 +291,51 @@ static uint8_t g_netdev_num = 0;
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: virtio_net_set_gso
+ *
+ * Description:
+ *   Ask the device to cut a TCP/IPv4 super-frame at the MTU.  The upper
+ *   half only hands such frames over when NETDEV_TX_TSO is set.  The
+ *   device computes the checksum of each segment from the pseudo-header
+ *   sum left in the TCP header.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NETDEV_TSO
+static void virtio_net_set_gso(FAR struct netdev_lowerhalf_s *dev,
+                               FAR netpkt_t *pkt,
+                               FAR struct virtio_net_hdr_s *vhdr)
+{
+  FAR struct ipv4_hdr_s *ipv4;
+  FAR struct tcp_hdr_s *tcp;
+  uint16_t iphdrlen;
+  uint16_t hdrlen;
+  uint16_t sum;
+
+  if (netpkt_getdatalen(dev, pkt) <= NETDEV_PKTSIZE(&dev->netdev))
+    {
+      return;
+    }
+
+  ipv4     = (FAR struct ipv4_hdr_s *)IOB_DATA(pkt);
+  iphdrlen = (ipv4->vhl & IPv4_HLMASK) << 2;
+  tcp      = (FAR struct tcp_hdr_s *)((FAR uint8_t *)ipv4 + iphdrlen);
+  hdrlen   = ETH_HDRLEN + iphdrlen + ((tcp->tcpoffset >> 4) << 2);
+
+  sum = pkt->io_pktlen - iphdrlen + IP_PROTO_TCP;
+  sum = chksum(sum, (FAR uint8_t *)ipv4->srcipaddr, 2 * sizeof(in_addr_t));
+  tcp->tcpchksum = HTONS(sum);
+
+  vhdr->flags       = VIRTIO_NET_HDR_F_NEEDS_CSUM;
+  vhdr->gso_type    = VIRTIO_NET_HDR_GSO_TCPV4;
+  vhdr->hdr_len     = hdrlen;
+  vhdr->gso_size    = NETDEV_PKTSIZE(&dev->netdev) - hdrlen;
+  vhdr->csum_start  = ETH_HDRLEN + iphdrlen;
+  vhdr->csum_offset = offsetof(struct tcp_hdr_s, tcpchksum);
+}
+#endif
+
 /****************************************************************************
  * Name: virtio_net_addbuffer
  ****************************************************************************/
@@ -216,14 +346,14 @@ static int virtio_net_addbuffer(FAR struct netdev_lowerhalf_s *dev,
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
   FAR struct virtio_net_llhdr_s *hdr;
-  struct virtqueue_buf vb[VIRTIO_NET_MAX_NIOB + 1];
-  struct iovec iov[VIRTIO_NET_MAX_NIOB];
+  struct virtqueue_buf vb[VIRTIO_NET_TX_MAX_NIOB + 1];
+  struct iovec iov[VIRTIO_NET_TX_MAX_NIOB];
   int iov_cnt;
   int i;
 
   /* Convert netpkt to virtqueue_buf */
 
-  iov_cnt = netpkt_to_iov(dev, pkt, iov, VIRTIO_NET_MAX_NIOB);
+  iov_cnt = netpkt_to_iov(dev, pkt, iov, VIRTIO_NET_TX_MAX_NIOB);
 
   /* Alloc cookie and net header from transport layer */
 
@@ -233,6 +363,13 @@ static int virtio_net_addbuffer(FAR struct netdev_lowerhalf_s *dev,
   memset(&hdr->vhdr, 0, sizeof(hdr->vhdr));
   hdr->pkt = pkt;
 
+#ifdef CONFIG_NETDEV_TSO
+  if (VIRTIO_NET_VQ_DIR(vq_id) == VIRTIO_NET_TX)
+    {
+      virtio_net_set_gso(dev, pkt, &hdr->vhdr);
+    }
+#endif
+
   /* Prepare buffers depends on the feature VIRTIO_F_ANY_LAYOUT */
 
   if (virtio_has_feature(priv->vdev, VIRTIO_F_ANY_LAYOUT))
@@ -242,7 +379,7 @@ static int virtio_net_addbuffer(FAR struct netdev_lowerhalf_s *dev,
       vb[0].buf = &hdr->vhdr;
       vb[0].len = iov[0].iov_len + VIRTIO_NET_HDRSIZE;
 
-#if VIRTIO_NET_MAX_NIOB > 1
+#if VIRTIO_NET_TX_MAX_NIOB > 1
       for (i = 1; i < iov_cnt; i++)
         {
           vb[i].buf = iov[i].iov_base;
@@ -267,7 +404,7 @@ static int virtio_net_addbuffer(FAR struct netdev_lowerhalf_s *dev,
     }
 
   vrtinfo("Fill vq=%u, hdr=%p, count=%d\n", vq_id, hdr, iov_cnt);
-  if (vq_id == VIRTIO_NET_RX)
+  if (VIRTIO_NET_VQ_DIR(vq_id) == VIRTIO_NET_RX)
     {
       return virtqueue_add_buffer_lock(vq, vb, 0, iov_cnt, hdr,
                                        &priv->lock[vq_id]);
@@ -283,14 +420,15 @@ static int virtio_net_addbuffer(FAR struct netdev_lowerhalf_s *dev,
  * Name: virtio_net_rxfill
  ****************************************************************************/
 
-static void virtio_net_rxfill(FAR struct netdev_lowerhalf_s *dev)
+static void virtio_net_rxfill(FAR struct netdev_lowerhalf_s *dev, int qid)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
-  FAR struct virtqueue *vq = priv->vdev->vrings_info[VIRTIO_NET_RX].vq;
+  unsigned int vq_id = VIRTIO_NET_VQ(qid, VIRTIO_NET_RX);
+  FAR struct virtqueue *vq = priv->vdev->vrings_info[vq_id].vq;
   FAR netpkt_t *pkt;
   int i;
 
-  for (i = 0; i < priv->bufnum; i++)
+  for (i = 0; priv->rxnum[qid] < priv->bufnum; i++)
     {
       /* IOB Offload, Alloc buffer from RX netpkt */
 
@@ -313,31 +451,38 @@ static void virtio_net_rxfill(FAR struct netdev_lowerhalf_s *dev)
 
       /* Add buffer to RX virtqueue */
 
-      virtio_net_addbuffer(dev, vq, pkt, VIRTIO_NET_RX);
+      if (virtio_net_addbuffer(dev, vq, pkt, vq_id) < 0)
+        {
+          netpkt_free(dev, pkt, NETPKT_RX);
+          break;
+        }
+
+      priv->rxnum[qid]++;
     }
 
   if (i > 0)
     {
-      virtqueue_kick_lock(vq, &priv->lock[VIRTIO_NET_RX]);
+      virtqueue_kick_lock(vq, &priv->lock[vq_id]);
     }
 }
 
 /****************************************************************************
- * Name: virtio_net_txfree
+ * Name: virtio_net_txfree_queue
  ****************************************************************************/
 
-static void virtio_net_txfree(FAR struct netdev_lowerhalf_s *dev)
+static void virtio_net_txfree_queue(FAR struct netdev_lowerhalf_s *dev,
+                                    int qid)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
-  FAR struct virtqueue *vq = priv->vdev->vrings_info[VIRTIO_NET_TX].vq;
+  unsigned int vq_id = VIRTIO_NET_VQ(qid, VIRTIO_NET_TX);
+  FAR struct virtqueue *vq = priv->vdev->vrings_info[vq_id].vq;
   FAR struct virtio_net_llhdr_s *hdr;
 
   while (1)
     {
       /* Get buffer from tx virtqueue */
 
-      hdr = virtqueue_get_buffer_lock(vq, NULL, NULL,
-                                      &priv->lock[VIRTIO_NET_TX]);
+      hdr = virtqueue_get_buffer_lock(vq, NULL, NULL, &priv->lock[vq_id]);
       if (hdr == NULL)
         {
           break;
@@ -348,6 +493,21 @@ static void virtio_net_txfree(FAR struct netdev_lowerhalf_s *dev)
     }
 }
 
+/****************************************************************************
+ * Name: virtio_net_txfree
+ ****************************************************************************/
+
+static void virtio_net_txfree(FAR struct netdev_lowerhalf_s *dev)
+{
+  FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
+  int i;
+
+  for (i = 0; i < priv->nqueues; i++)
+    {
+      virtio_net_txfree_queue(dev, i);
+    }
+}
+
 /****************************************************************************
  * Name: virtio_net_ifup
  ****************************************************************************/
@@ -355,6 +515,8 @@ static void virtio_net_txfree(FAR struct netdev_lowerhalf_s *dev)
 static int virtio_net_ifup(FAR struct netdev_lowerhalf_s *dev)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
+  unsigned int vq_id;
+  int i;
 
 #ifdef CONFIG_NET_IPv4
   vrtinfo("Bringing up: %u.%u.%u.%u\n",
@@ -371,9 +533,13 @@ static int virtio_net_ifup(FAR struct netdev_lowerhalf_s *dev)
 
   /* Prepare interrupt and packets for receiving */
 
-  virtqueue_enable_cb_lock(priv->vdev->vrings_info[VIRTIO_NET_RX].vq,
-                           &priv->lock[VIRTIO_NET_RX]);
-  virtio_net_rxfill(dev);
+  for (i = 0; i < priv->nqueues; i++)
+    {
+      vq_id = VIRTIO_NET_VQ(i, VIRTIO_NET_RX);
+      virtqueue_enable_cb_lock(priv->vdev->vrings_info[vq_id].vq,
+                               &priv->lock[vq_id]);
+      virtio_net_rxfill(dev, i);
+    }
 
 #ifdef CONFIG_DRIVERS_WIFI_SIM
   if (priv->lower.wifi == NULL)
@@ -396,7 +562,7 @@ static int virtio_net_ifdown(FAR struct netdev_lowerhalf_s *dev)
 
   /* Disable the Ethernet interrupt */
 
-  for (i = 0; i < VIRTIO_NET_NUM; i++)
+  for (i = 0; i < VIRTIO_NET_NUM * priv->nqueues; i++)
     {
       virtqueue_disable_cb_lock(priv->vdev->vrings_info[i].vq,
                                 &priv->lock[i]);
@@ -416,77 +582,104 @@ static int virtio_net_ifdown(FAR struct netdev_lowerhalf_s *dev)
 }
 
 /****************************************************************************
- * Name: virtio_net_send
+ * Name: virtio_net_send_queue
  ****************************************************************************/
 
-static int virtio_net_send(FAR struct netdev_lowerhalf_s *dev,
-                           FAR netpkt_t *pkt)
+static int virtio_net_send_queue(FAR struct netdev_lowerhalf_s *dev,
+                                 int qid, FAR netpkt_t *pkt)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
-  FAR struct virtqueue *vq = priv->vdev->vrings_info[VIRTIO_NET_TX].vq;
+  unsigned int vq_id = VIRTIO_NET_VQ(qid, VIRTIO_NET_TX);
+  FAR struct virtqueue *vq = priv->vdev->vrings_info[vq_id].vq;
+  int ret;
+  int i;
 
   /* Check the send length */
 
-  if (netpkt_getdatalen(dev, pkt) > VIRTIO_NET_BUFSIZE)
+  if (netpkt_getdatalen(dev, pkt) > VIRTIO_NET_TX_BUFSIZE)
     {
       vrterr("net send buffer too large\n");
       return -EINVAL;
     }
 
-  /* Add buffer to vq and notify the other side */
+  /* Add buffer to vq and notify the other side, a TSO frame may need more
+   * descriptors than are left.
+   */
+
+  ret = virtio_net_addbuffer(dev, vq, pkt, vq_id);
+  if (ret < 0)
+    {
+      virtio_net_txfree_queue(dev, qid);
+      ret = virtio_net_addbuffer(dev, vq, pkt, vq_id);
+      if (ret < 0)
+        {
+          vrterr("net send no descriptors, ret=%d\n", ret);
+          return -ENOBUFS;
+        }
+    }
 
-  virtio_net_addbuffer(dev, vq, pkt, VIRTIO_NET_TX);
-  virtqueue_kick_lock(vq, &priv->lock[VIRTIO_NET_TX]);
+  virtqueue_kick_lock(vq, &priv->lock[vq_id]);
 
   /* Try return Netpkt TX buffer to upper-half. */
 
-  virtio_net_txfree(dev);
+  virtio_net_txfree_queue(dev, qid);
 
-  /* If we have no buffer left, enable TX done callback. */
+  /* If we have no buffer left, enable TX done callback.  The buffers may
+   * be held by any of the TX queues.
+   */
 
   if (netdev_lower_quota_load(dev, NETPKT_TX) <= 0)
     {
-      virtqueue_enable_cb_lock(vq, &priv->lock[VIRTIO_NET_TX]);
+      for (i = 0; i < priv->nqueues; i++)
+        {
+          vq_id = VIRTIO_NET_VQ(i, VIRTIO_NET_TX);
+          virtqueue_enable_cb_lock(priv->vdev->vrings_info[vq_id].vq,
+                                   &priv->lock[vq_id]);
+        }
     }
 
   return OK;
 }
 
 /****************************************************************************
- * Name: virtio_net_recv
+ * Name: virtio_net_recv_queue
  ****************************************************************************/
 
-static netpkt_t *virtio_net_recv(FAR struct netdev_lowerhalf_s *dev)
+static netpkt_t *virtio_net_recv_queue(FAR struct netdev_lowerhalf_s *dev,
+                                       int qid)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
-  FAR struct virtqueue *vq = priv->vdev->vrings_info[VIRTIO_NET_RX].vq;
+  unsigned int vq_id = VIRTIO_NET_VQ(qid, VIRTIO_NET_RX);
+  FAR struct virtqueue *vq = priv->vdev->vrings_info[vq_id].vq;
   FAR struct virtio_net_llhdr_s *hdr;
   irqstate_t flags;
   uint32_t len;
 
   /* Fill the free Netpkt RX buffer to the RX virtqueue */
 
-  virtio_net_rxfill(dev);
+  virtio_net_rxfill(dev, qid);
 
   /* Get received buffer form RX virtqueue */
 
-  flags = spin_lock_irqsave(&priv->lock[VIRTIO_NET_RX]);
+  flags = spin_lock_irqsave(&priv->lock[vq_id]);
   hdr = virtqueue_get_buffer(vq, &len, NULL);
   if (hdr == NULL)
     {
       /* If we have no buffer left, enable RX callback. */
 
       virtqueue_enable_cb(vq);
-      spin_unlock_irqrestore(&priv->lock[VIRTIO_NET_RX], flags);
+      spin_unlock_irqrestore(&priv->lock[vq_id], flags);
 
       vrtinfo("get NULL buffer\n");
       return NULL;
     }
   else
     {
-      spin_unlock_irqrestore(&priv->lock[VIRTIO_NET_RX], flags);
+      spin_unlock_irqrestore(&priv->lock[vq_id], flags);
     }
 
+  priv->rxnum[qid]--;
+
   /* Set the received pkt length */
 
   netpkt_setdatalen(dev, hdr->pkt, len - VIRTIO_NET_HDRSIZE);
@@ -494,6 +687,27 @@ static netpkt_t *virtio_net_recv(FAR struct netdev_lowerhalf_s *dev)
   return hdr->pkt;
 }
 
+#ifndef CONFIG_NETDEV_RSS
+/****************************************************************************
+ * Name: virtio_net_send
+ ****************************************************************************/
+
+static int virtio_net_send(FAR struct netdev_lowerhalf_s *dev,
+                           FAR netpkt_t *pkt)
+{
+  return virtio_net_send_queue(dev, 0, pkt);
+}
+
+/****************************************************************************
+ * Name: virtio_net_recv
+ ****************************************************************************/
+
+static netpkt_t *virtio_net_recv(FAR struct netdev_lowerhalf_s *dev)
+{
+  return virtio_net_recv_queue(dev, 0);
+}
+#endif
+
 #ifdef CONFIG_NET_MCASTGROUP
 /****************************************************************************
  * Name: virtio_net_addmac
@@ -536,8 +750,13 @@ static void virtio_net_rxready(FAR struct virtqueue *vq)
 {
   FAR struct virtio_net_priv_s *priv = vq->vq_dev->priv;
 
-  virtqueue_disable_cb_lock(vq, &priv->lock[VIRTIO_NET_RX]);
+  virtqueue_disable_cb_lock(vq, &priv->lock[vq->vq_queue_index]);
+#ifdef CONFIG_NETDEV_RSS
+  netdev_lower_rxready_queue((FAR struct netdev_lowerhalf_s *)priv,
+                             VIRTIO_NET_VQ_QID(vq->vq_queue_index));
+#else
   netdev_lower_rxready((FAR struct netdev_lowerhalf_s *)priv);
+#endif
 }
 
 /****************************************************************************
@@ -548,10 +767,65 @@ static void virtio_net_txdone(FAR struct virtqueue *vq)
 {
   FAR struct virtio_net_priv_s *priv = vq->vq_dev->priv;
 
-  virtqueue_disable_cb_lock(vq, &priv->lock[VIRTIO_NET_TX]);
+  virtqueue_disable_cb_lock(vq, &priv->lock[vq->vq_queue_index]);
   netdev_lower_txdone((FAR struct netdev_lowerhalf_s *)priv);
 }
 
+/****************************************************************************
+ * Name: virtio_net_set_queues
+ *
+ * Description:
+ *   Tell the device how many queue pairs are used.  Until then the device
+ *   only uses the first one.  The device answers the control command at
+ *   once, so the ack is polled.
+ *
+ ****************************************************************************/
+
+#if VIRTIO_NET_NQUEUES > 1
+static int virtio_net_set_queues(FAR struct virtio_net_priv_s *priv,
+                                 FAR struct virtqueue *vq, int nqueues)
+{
+  FAR struct virtio_net_ctrl_s *ctrl = &priv->ctrl;
+  struct virtqueue_buf vb[3];
+  int retry;
+  int ret;
+
+  ctrl->class = VIRTIO_NET_CTRL_MQ;
+  ctrl->cmd   = VIRTIO_NET_CTRL_MQ_VQ_PAIRS_SET;
+  ctrl->pairs = nqueues;
+  ctrl->ack   = 0xff;
+
+  /* Header and data are read by the device, the ack is written */
+
+  vb[0].buf = &ctrl->class;
+  vb[0].len = sizeof(ctrl->class) + sizeof(ctrl->cmd);
+  vb[1].buf = &ctrl->pairs;
+  vb[1].len = sizeof(ctrl->pairs);
+  vb[2].buf = &ctrl->ack;
+  vb[2].len = sizeof(ctrl->ack);
+
+  ret = virtqueue_add_buffer(vq, vb, 2, 1, ctrl);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  virtqueue_kick(vq);
+
+  for (retry = 0; virtqueue_get_buffer(vq, NULL, NULL) == NULL; retry++)
+    {
+      if (retry >= VIRTIO_NET_CTRL_RETRY)
+        {
+          return -ETIMEDOUT;
+        }
+
+      up_udelay(10);
+    }
+
+  return ctrl->ack == VIRTIO_NET_OK ? OK : -EIO;
+}
+#endif
+
 /****************************************************************************
  * Name: virtio_net_init
  ****************************************************************************/
@@ -559,28 +833,80 @@ static void virtio_net_txdone(FAR struct virtqueue *vq)
 static int virtio_net_init(FAR struct virtio_net_priv_s *priv,
                            FAR struct virtio_device *vdev)
 {
-  FAR const char *vqnames[VIRTIO_NET_NUM];
-  vq_callback callbacks[VIRTIO_NET_NUM];
+  FAR const char **vqnames;
+  FAR vq_callback *callbacks;
+  uint16_t maxpairs = 1;
+  unsigned int nvqs = VIRTIO_NET_NUM;
+  unsigned int i;
   int ret;
 
-  spin_lock_init(&priv->lock[VIRTIO_NET_RX]);
-  spin_lock_init(&priv->lock[VIRTIO_NET_TX]);
-  priv->vdev = vdev;
-  vdev->priv = priv;
+  for (i = 0; i < VIRTIO_NET_NUM * VIRTIO_NET_NQUEUES; i++)
+    {
+      spin_lock_init(&priv->lock[i]);
+    }
+
+  priv->vdev    = vdev;
+  priv->nqueues = 1;
+  vdev->priv    = priv;
 
   /* Initialize the virtio device */
 
   virtio_set_status(vdev, VIRTIO_CONFIG_STATUS_DRIVER);
   virtio_negotiate_features(vdev, (1UL << VIRTIO_NET_F_MAC) |
+#ifdef CONFIG_NETDEV_TSO
+                                  (1UL << VIRTIO_NET_F_CSUM) |
+                                  (1UL << VIRTIO_NET_F_HOST_TSO4) |
+#endif
+#if VIRTIO_NET_NQUEUES > 1
+                                  (1UL << VIRTIO_NET_F_CTRL_VQ) |
+                                  (1UL << VIRTIO_NET_F_MQ) |
+#endif
                                   (1UL << VIRTIO_F_ANY_LAYOUT), NULL);
   virtio_set_status(vdev, VIRTIO_CONFIG_FEATURES_OK);
 
-  vqnames[VIRTIO_NET_RX]   = "virtio_net_rx";
-  vqnames[VIRTIO_NET_TX]   = "virtio_net_tx";
-  callbacks[VIRTIO_NET_RX] = virtio_net_rxready;
-  callbacks[VIRTIO_NET_TX] = virtio_net_txdone;
-  ret = virtio_create_virtqueues(vdev, 0, VIRTIO_NET_NUM, vqnames,
-                                 callbacks, NULL);
+#if VIRTIO_NET_NQUEUES > 1
+  /* The control virtqueue comes after all the queue pairs of the device,
+   * so all of them are created even if only some are used.
+   */
+
+  if (virtio_has_feature(vdev, VIRTIO_NET_F_CTRL_VQ) &&
+      virtio_has_feature(vdev, VIRTIO_NET_F_MQ))
+    {
+      virtio_read_config_member(vdev, struct virtio_net_config_s,
+                                max_virtqueue_pairs, &maxpairs);
+      maxpairs = MAX(maxpairs, 1);
+      nvqs     = VIRTIO_NET_NUM * maxpairs + 1;
+    }
+#endif
+
+  vqnames = kmm_malloc(nvqs * (sizeof(*vqnames) + sizeof(*callbacks)));
+  if (vqnames == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  callbacks = (FAR vq_callback *)(vqnames + nvqs);
+  for (i = 0; i < nvqs; i++)
+    {
+      if (i == VIRTIO_NET_NUM * maxpairs)
+        {
+          vqnames[i]   = "virtio_net_ctrl";
+          callbacks[i] = NULL;
+        }
+      else if (VIRTIO_NET_VQ_DIR(i) == VIRTIO_NET_RX)
+        {
+          vqnames[i]   = "virtio_net_rx";
+          callbacks[i] = virtio_net_rxready;
+        }
+      else
+        {
+          vqnames[i]   = "virtio_net_tx";
+          callbacks[i] = virtio_net_txdone;
+        }
+    }
+
+  ret = virtio_create_virtqueues(vdev, 0, nvqs, vqnames, callbacks, NULL);
+  kmm_free(vqnames);
   if (ret < 0)
     {
       vrterr("virtio_device_create_virtqueue failed, ret=%d\n", ret);
@@ -589,14 +915,31 @@ static int virtio_net_init(FAR struct virtio_net_priv_s *priv,
 
   virtio_set_status(vdev, VIRTIO_CONFIG_STATUS_DRIVER_OK);
 
+#if VIRTIO_NET_NQUEUES > 1
+  if (nvqs > VIRTIO_NET_NUM)
+    {
+      ret = virtio_net_set_queues(priv, vdev->vrings_info[nvqs - 1].vq,
+                                  MIN(maxpairs, VIRTIO_NET_NQUEUES));
+      if (ret < 0)
+        {
+          vrtwarn("Set queue pairs failed, ret=%d\n", ret);
+        }
+      else
+        {
+          priv->nqueues = MIN(maxpairs, VIRTIO_NET_NQUEUES);
+        }
+    }
+#endif
+
 #if CONFIG_DRIVERS_VIRTIO_NET_BUFNUM > 0
   priv->bufnum = CONFIG_DRIVERS_VIRTIO_NET_BUFNUM;
 #else
   /* Calculate the virtio network buffer number:
-   * 1/4 for the TX netpkts, 1/4 for the RX netpkts.
+   * 1/4 for the TX netpkts, 1/4 for the RX netpkts, split between queues.
    */
 
-  priv->bufnum = CONFIG_IOB_NBUFFERS / VIRTIO_NET_MAX_NIOB / 4;
+  priv->bufnum = CONFIG_IOB_NBUFFERS / VIRTIO_NET_MAX_NIOB / 4 /
+                 priv->nqueues;
 #endif
   priv->bufnum = MIN(vdev->vrings_info[VIRTIO_NET_RX].info.num_descs /
                      (VIRTIO_NET_MAX_NIOB + 1), priv->bufnum);
@@ -658,10 +1001,34 @@ static int virtio_net_probe(FAR struct virtio_device *vdev)
   /* Initialize the netdev lower half */
 
   netdev = (FAR struct netdev_lowerhalf_s *)priv;
-  netdev->quota[NETPKT_RX] = priv->bufnum;
-  netdev->quota[NETPKT_TX] = priv->bufnum;
+  netdev->quota[NETPKT_RX] = priv->bufnum * priv->nqueues;
+  netdev->quota[NETPKT_TX] = priv->bufnum * priv->nqueues;
   netdev->ops = &g_virtio_net_ops;
 
+#ifdef CONFIG_NETDEV_RSS
+  netdev->nqueues = priv->nqueues;
+  if (priv->nqueues > 1)
+    {
+      netdev->rxtype   = NETDEV_RX_THREAD_RSS;
+      netdev->priority = CONFIG_DRIVERS_VIRTIO_NET_PRIORITY;
+    }
+#endif
+
+#ifdef CONFIG_NETDEV_TSO
+  /* The device cuts TCP super-frames if a whole one fits in the TX ring */
+
+  if (virtio_has_feature(vdev, VIRTIO_NET_F_HOST_TSO4) &&
+      vdev->vrings_info[VIRTIO_NET_TX].info.num_descs >
+      VIRTIO_NET_TX_MAX_NIOB + 1)
+    {
+      netdev->netdev.d_features |= NETDEV_TX_TSO;
+    }
+#endif
+
+#ifdef CONFIG_NETDEV_GRO
+  netdev->netdev.d_features |= NETDEV_RX_GRO;
+#endif
+
 #ifdef CONFIG_DRIVERS_WIFI_SIM
   /* If the WiFi interfaces has reached the setting value,
    * no more WiFi interfaces will be created.
@@ -28,6 +28,7 @@
 #include <nuttx/config.h>
 
 #include <sys/types.h>
+#include <stdbool.h>
 #include <string.h>
 #include <aio.h>
 
@@ -48,6 +49,19 @@
 #  define CONFIG_FS_NAIOC 8
 #endif
 
+/* The worker threads are boosted to the priority of the waiting task */
+
+#if defined(CONFIG_PRIORITY_INHERITANCE) && defined(CONFIG_FS_AIO_WORKQUEUE)
+#  define aio_boostpriority(p)   work_boostpriority_wq(g_aio_wqueue, p)
+#  define aio_restorepriority(p) work_restorepriority_wq(g_aio_wqueue, p)
+#elif defined(CONFIG_PRIORITY_INHERITANCE)
+#  define aio_boostpriority(p)   lpwork_boostpriority(p)
+#  define aio_restorepriority(p) lpwork_restorepriority(p)
+#else
+#  define aio_boostpriority(p)   UNUSED(p)
+#  define aio_restorepriority(p) UNUSED(p)
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -65,6 +79,15 @@ struct aio_container_s
   FAR struct file *aioc_filep;     /* File structure to use with the I/O */
   struct work_s aioc_work;         /* Used to defer I/O to the work thread */
   pid_t aioc_pid;                  /* ID of the waiting task */
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+  worker_t aioc_worker;            /* Worker that performs the I/O */
+
+  /* The next request on the same file, waiting for this one to complete */
+
+  FAR struct aio_container_s *aioc_next;
+  bool aioc_started;               /* The I/O is in progress */
+  bool aioc_canceled;              /* Canceled while on the work queue */
+#endif
 #ifdef CONFIG_PRIORITY_INHERITANCE
   uint8_t aioc_prio;               /* Priority of the waiting task */
 #endif
@@ -89,6 +112,12 @@ extern "C"
 
 EXTERN dq_queue_t g_aio_pending;
 
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+/* The AIO work queue, created when the first request is queued */
+
+EXTERN FAR struct kwork_wqueue_s *g_aio_wqueue;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -206,7 +235,8 @@ FAR struct aiocb *aioc_decant(FAR struct aio_container_s *aioc);
  * Name: aio_queue
  *
  * Description:
- *   Schedule the asynchronous I/O on the low priority work queue
+ *   Schedule the asynchronous I/O on the low priority work queue, or on the
+ *   AIO work queue if CONFIG_FS_AIO_WORKQUEUE is selected
  *
  * Input Parameters:
  *   arg - Worker argument.  In this case, a pointer to an instance of
@@ -220,6 +250,69 @@ FAR struct aiocb *aioc_decant(FAR struct aio_container_s *aioc);
 
 int aio_queue(FAR struct aio_container_s *aioc, worker_t worker);
 
+/****************************************************************************
+ * Name: aio_dequeue
+ *
+ * Description:
+ *   Remove an asynchronous I/O that has not been started yet from the
+ *   queue.  The caller must hold the AIO lock.
+ *
+ *   On the AIO work queue, a request that is still queued is only marked
+ *   as canceled.  aioc_decant() then leaves its container to the worker,
+ *   which frees it in aio_start().
+ *
+ * Input Parameters:
+ *   aioc - The AIO container of the request
+ *
+ * Returned Value:
+ *   Zero (OK) if the request was removed.  -ENOENT if it is already in
+ *   progress.
+ *
+ ****************************************************************************/
+
+int aio_dequeue(FAR struct aio_container_s *aioc);
+
+/****************************************************************************
+ * Name: aio_queue_next
+ *
+ * Description:
+ *   Start the asynchronous I/O on the same file that waits for the request
+ *   in 'aioc' to complete, if there is one.  The caller must hold the AIO
+ *   lock.
+ *
+ * Input Parameters:
+ *   aioc - The AIO container of the completed request
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+void aio_queue_next(FAR struct aio_container_s *aioc);
+#endif
+
+/****************************************************************************
+ * Name: aio_start
+ *
+ * Description:
+ *   Called by the worker before it starts the I/O.  Marks the request as
+ *   in progress so that it can no longer be canceled, or frees the
+ *   container of a request that was canceled while it was queued.
+ *
+ * Input Parameters:
+ *   aioc - The AIO container of the request
+ *
+ * Returned Value:
+ *   True if the I/O is to be performed.  False if the request was
+ *   canceled; the container has been freed then.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+bool aio_start(FAR struct aio_container_s *aioc);
+#endif
+
 /****************************************************************************
  * Name: aio_signal
  *
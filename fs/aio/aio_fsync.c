@@ -74,12 +74,29 @@ static void aio_fsync_worker(FAR void *arg)
    * the delays by any other threads waiting for a pre-allocated container.
    */
 
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+  /* Nothing to do if the request was canceled while it was queued */
+
+  if (!aio_start(aioc))
+    {
+      return;
+    }
+
+#endif
   DEBUGASSERT(aioc && aioc->aioc_aiocbp);
   pid    = aioc->aioc_pid;
 #ifdef CONFIG_PRIORITY_INHERITANCE
   prio   = aioc->aioc_prio;
 #endif
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+  /* On the AIO work queue the container stays pending until the I/O is
+   * complete, so that later requests on the same file wait for it.
+   */
+
+  aiocbp = aioc->aioc_aiocbp;
+#else
   aiocbp = aioc_decant(aioc);
+#endif
 
   /* Perform the fsync using aioc_filep */
 
@@ -94,6 +111,10 @@ static void aio_fsync_worker(FAR void *arg)
       aiocbp->aio_result = OK;
     }
 
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+  aioc_decant(aioc);
+#endif
+
   /* Signal the client */
 
   aio_signal(pid, aiocbp);
@@ -101,7 +122,7 @@ static void aio_fsync_worker(FAR void *arg)
 #ifdef CONFIG_PRIORITY_INHERITANCE
   /* Restore the low priority worker thread default priority */
 
-  lpwork_restorepriority(prio);
+  aio_restorepriority(prio);
 #endif
 }
 
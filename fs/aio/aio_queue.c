@@ -26,6 +26,7 @@
 
 #include <nuttx/config.h>
 
+#include <stdbool.h>
 #include <sched.h>
 #include <aio.h>
 #include <assert.h>
@@ -38,15 +39,82 @@
 
 #ifdef CONFIG_FS_AIO
 
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+/* The AIO work queue, created when the first request is queued */
+
+FAR struct kwork_wqueue_s *g_aio_wqueue;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: aio_queue_work
+ *
+ * Description:
+ *   Hand the asynchronous I/O to the work queue.
+ *
+ ****************************************************************************/
+
+static int aio_queue_work(FAR struct aio_container_s *aioc, worker_t worker)
+{
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+  return work_queue_wq(g_aio_wqueue, &aioc->aioc_work, worker, aioc, 0);
+#else
+  return work_queue(LPWORK, &aioc->aioc_work, worker, aioc, 0);
+#endif
+}
+
+/****************************************************************************
+ * Name: aio_queue_wait
+ *
+ * Description:
+ *   Requests on the same file are run one at a time, in the order in which
+ *   they were submitted.  Containers stay on the pending list until their
+ *   I/O is complete, so if an earlier request on the same file is found
+ *   there, the new request is chained behind the last one of them and is
+ *   started by aio_queue_next() when that completes.
+ *
+ * Returned Value:
+ *   True if the request has to wait for an earlier one.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+static bool aio_queue_wait(FAR struct aio_container_s *aioc)
+{
+  FAR struct aio_container_s *prev;
+
+  for (prev = (FAR struct aio_container_s *)aioc->aioc_link.blink;
+       prev != NULL && prev->aioc_filep != aioc->aioc_filep;
+       prev = (FAR struct aio_container_s *)prev->aioc_link.blink);
+
+  if (prev == NULL)
+    {
+      return false;
+    }
+
+  DEBUGASSERT(prev->aioc_next == NULL);
+  prev->aioc_next = aioc;
+  return true;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
 /****************************************************************************
  * Name: aio_queue
  *
  * Description:
- *   Schedule the asynchronous I/O on the low priority work queue
+ *   Schedule the asynchronous I/O on the low priority work queue, or on the
+ *   AIO work queue if CONFIG_FS_AIO_WORKQUEUE is selected
  *
  * Input Parameters:
  *   arg - Worker argument.  In this case, a pointer to an instance of
@@ -62,6 +130,36 @@ int aio_queue(FAR struct aio_container_s *aioc, worker_t worker)
 {
   int ret;
 
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+  ret = aio_lock();
+  if (ret < 0)
+    {
+      goto errout;
+    }
+
+  /* Create the AIO work queue on first use */
+
+  if (g_aio_wqueue == NULL)
+    {
+      g_aio_wqueue = work_queue_create("aio", CONFIG_FS_AIO_PRIORITY, NULL,
+                                       CONFIG_FS_AIO_STACKSIZE,
+                                       CONFIG_FS_AIO_NTHREADS);
+      if (g_aio_wqueue == NULL)
+        {
+          aio_unlock();
+          ret = -ENOMEM;
+          goto errout;
+        }
+    }
+
+  aioc->aioc_worker = worker;
+  if (!aioc->aioc_canceled && aio_queue_wait(aioc))
+    {
+      aio_unlock();
+      return OK;
+    }
+#endif
+
 #ifdef CONFIG_PRIORITY_INHERITANCE
   /* Prohibit context switches until we complete the queuing */
 
@@ -71,31 +169,172 @@ int aio_queue(FAR struct aio_container_s *aioc, worker_t worker)
    * the priority specified for this action.
    */
 
-  lpwork_boostpriority(aioc->aioc_prio);
+  aio_boostpriority(aioc->aioc_prio);
 #endif
 
-  /* Schedule the work on the low priority worker thread */
+  /* Schedule the work on the worker thread */
 
-  ret = work_queue(LPWORK, &aioc->aioc_work, worker, aioc, 0);
+  ret = aio_queue_work(aioc, worker);
   if (ret < 0)
     {
-      FAR struct aiocb *aiocbp = aioc->aioc_aiocbp;
-      DEBUGASSERT(aiocbp);
+#ifdef CONFIG_PRIORITY_INHERITANCE
+      aio_restorepriority(aioc->aioc_prio);
+#endif
+    }
 
 #ifdef CONFIG_PRIORITY_INHERITANCE
-      lpwork_restorepriority(aioc->aioc_prio);
+  /* Now the low-priority work queue might run at its new priority */
+
+  sched_unlock();
+#endif
+
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+  aio_unlock();
+
+errout:
 #endif
+  if (ret < 0)
+    {
+      FAR struct aiocb *aiocbp = aioc->aioc_aiocbp;
+      DEBUGASSERT(aiocbp);
+
       aiocbp->aio_result = ret;
       set_errno(-ret);
       ret = ERROR;
     }
 
+  return ret;
+}
+
+/****************************************************************************
+ * Name: aio_dequeue
+ *
+ * Description:
+ *   Remove an asynchronous I/O that has not been started yet from the
+ *   queue.  The caller must hold the AIO lock.
+ *
+ *   On the AIO work queue, a request that is still queued is only marked
+ *   as canceled.  aioc_decant() then leaves its container to the worker,
+ *   which frees it in aio_start().
+ *
+ ****************************************************************************/
+
+int aio_dequeue(FAR struct aio_container_s *aioc)
+{
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+  FAR struct aio_container_s *prev;
+
+  /* A request that waits for an earlier one on the same file is not on the
+   * work queue.  Its successor, if any, waits for the earlier one instead.
+   */
+
+  for (prev = (FAR struct aio_container_s *)g_aio_pending.head;
+       prev != NULL && prev->aioc_next != aioc;
+       prev = (FAR struct aio_container_s *)prev->aioc_link.flink);
+
+  if (prev != NULL)
+    {
+      prev->aioc_next = aioc->aioc_next;
+      aioc->aioc_next = NULL;
+      return OK;
+    }
+
+  /* work_cancel_wq() cannot tell whether a worker thread has already taken
+   * the work, so the work is left queued.  The request is only marked as
+   * canceled and aio_start() drops it when it runs.
+   */
+
+  if (aioc->aioc_started)
+    {
+      return -ENOENT;
+    }
+
+  aioc->aioc_canceled = true;
+  return OK;
+#else
+  return work_cancel(LPWORK, &aioc->aioc_work);
+#endif
+}
+
+/****************************************************************************
+ * Name: aio_queue_next
+ *
+ * Description:
+ *   Start the asynchronous I/O on the same file that waits for the request
+ *   in 'aioc' to complete, if there is one.  The caller must hold the AIO
+ *   lock.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+void aio_queue_next(FAR struct aio_container_s *aioc)
+{
+  FAR struct aio_container_s *next = aioc->aioc_next;
+
+  if (next != NULL)
+    {
+      aioc->aioc_next = NULL;
+
 #ifdef CONFIG_PRIORITY_INHERITANCE
-  /* Now the low-priority work queue might run at its new priority */
+      sched_lock();
+      aio_boostpriority(next->aioc_prio);
+#endif
 
-  sched_unlock();
+      DEBUGVERIFY(aio_queue_work(next, next->aioc_worker));
+
+#ifdef CONFIG_PRIORITY_INHERITANCE
+      sched_unlock();
 #endif
-  return ret;
+    }
 }
+#endif
+
+/****************************************************************************
+ * Name: aio_start
+ *
+ * Description:
+ *   Called by the worker before it starts the I/O.  Marks the request as
+ *   in progress so that it can no longer be canceled, or frees the
+ *   container of a request that was canceled while it was queued.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+bool aio_start(FAR struct aio_container_s *aioc)
+{
+  bool canceled;
+  int ret;
+
+  do
+    {
+      ret = aio_lock();
+
+      /* The only possible error should be if we were awakened only by
+       * thread cancellation.
+       */
+
+      DEBUGASSERT(ret == OK || ret == -ECANCELED);
+    }
+  while (ret < 0);
+
+  canceled = aioc->aioc_canceled;
+  if (canceled)
+    {
+#ifdef CONFIG_PRIORITY_INHERITANCE
+      /* Drop the boost that was taken when the request was queued */
+
+      aio_restorepriority(aioc->aioc_prio);
+#endif
+      aioc_free(aioc);
+    }
+  else
+    {
+      aioc->aioc_started = true;
+    }
+
+  aio_unlock();
+  return !canceled;
+}
+#endif
 
 #endif /* CONFIG_FS_AIO */
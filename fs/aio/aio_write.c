@@ -77,12 +77,29 @@ static void aio_write_worker(FAR void *arg)
    * the delays by any other threads waiting for a pre-allocated container.
    */
 
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+  /* Nothing to do if the request was canceled while it was queued */
+
+  if (!aio_start(aioc))
+    {
+      return;
+    }
+
+#endif
   DEBUGASSERT(aioc && aioc->aioc_aiocbp);
   pid    = aioc->aioc_pid;
 #ifdef CONFIG_PRIORITY_INHERITANCE
   prio   = aioc->aioc_prio;
 #endif
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+  /* On the AIO work queue the container stays pending until the I/O is
+   * complete, so that later requests on the same file wait for it.
+   */
+
+  aiocbp = aioc->aioc_aiocbp;
+#else
   aiocbp = aioc_decant(aioc);
+#endif
 
   /* Call fcntl(F_GETFL) to get the file open mode. */
 
@@ -131,6 +148,10 @@ static void aio_write_worker(FAR void *arg)
 
 errout:
 
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+  aioc_decant(aioc);
+#endif
+
   /* Signal the client */
 
   aio_signal(pid, aiocbp);
@@ -138,7 +159,7 @@ errout:
 #ifdef CONFIG_PRIORITY_INHERITANCE
   /* Restore the low priority worker thread default priority */
 
-  lpwork_restorepriority(prio);
+  aio_restorepriority(prio);
 #endif
 }
 
@@ -150,13 +150,29 @@ FAR struct aiocb *aioc_decant(FAR struct aio_container_s *aioc)
     {
       dq_rem(&aioc->aioc_link, &g_aio_pending);
 
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+      /* Start the next request on the same file */
+
+      aio_queue_next(aioc);
+#endif
+
       /* De-cant the AIO control block and return the container to the
        * free list.
        */
 
       aiocbp = aioc->aioc_aiocbp;
       file_put(aioc->aioc_filep);
-      aioc_free(aioc);
+
+#ifdef CONFIG_FS_AIO_WORKQUEUE
+      /* The container of a request canceled on the work queue is freed by
+       * its worker.
+       */
+
+      if (!aioc->aioc_canceled)
+#endif
+        {
+          aioc_free(aioc);
+        }
 
       aio_unlock();
     }
@@ -113,6 +113,7 @@ static int     fat_stat_root(FAR struct fat_mountpt_s *fs,
                  FAR struct stat *buf);
 static int     fat_stat(struct inode *mountpt, const char *relpath,
                  FAR struct stat *buf);
+static int     fat_syncfs(FAR struct inode *mountpt);
 
 /****************************************************************************
  * Public Data
@@ -156,7 +157,8 @@ const struct mountpt_operations g_fat_operations =
   fat_rmdir,         /* rmdir */
   fat_rename,        /* rename */
   fat_stat,          /* stat */
-  NULL               /* chstat */
+  NULL,              /* chstat */
+  fat_syncfs         /* syncfs */
 };
 
 /****************************************************************************
@@ -2739,6 +2741,15 @@ static int fat_unbind(FAR void *handle, FAR struct inode **blkdriver,
         }
     }
 
+#ifdef CONFIG_FAT_LRUCACHE
+  /* Write back what the sector cache still holds */
+
+  if (fs->fs_mounted)
+    {
+      fat_updatefsinfo(fs);
+    }
+#endif
+
   /* Unmount ... close the block driver */
 
   if (fs->fs_blkdriver)
@@ -2771,6 +2782,13 @@ static int fat_unbind(FAR void *handle, FAR struct inode **blkdriver,
       fat_io_free(fs->fs_buffer, fs->fs_hwsectorsize);
     }
 
+#ifdef CONFIG_FAT_LRUCACHE
+  fat_cacheuninitialize(fs);
+#endif
+#ifdef CONFIG_FAT_FREEMAP
+  fs_heap_free(fs->fs_freemap);
+#endif
+
   nxmutex_destroy(&fs->fs_lock);
   fs_heap_free(fs);
   return OK;
@@ -3505,6 +3523,59 @@ errout_with_lock:
   return ret;
 }
 
+/****************************************************************************
+ * Name: fat_syncfs
+ *
+ * Description: Write all buffered data of the volume to the media.
+ *
+ ****************************************************************************/
+
+static int fat_syncfs(FAR struct inode *mountpt)
+{
+  FAR struct fat_mountpt_s *fs;
+  FAR struct fat_file_s *ff;
+  int ret;
+
+  /* Sanity checks */
+
+  DEBUGASSERT(mountpt && mountpt->i_private);
+
+  /* Get the mountpoint private data from the inode structure */
+
+  fs = mountpt->i_private;
+
+  ret = nxmutex_lock(&fs->fs_lock);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  ret = fat_checkmount(fs);
+  if (ret < 0)
+    {
+      goto errout_with_lock;
+    }
+
+  /* Flush the partial sectors buffered by the open files, then the
+   * mountpoint sector cache and FSINFO.
+   */
+
+  for (ff = fs->fs_head; ff != NULL; ff = ff->ff_next)
+    {
+      ret = fat_ffcacheflush(fs, ff);
+      if (ret < 0)
+        {
+          goto errout_with_lock;
+        }
+    }
+
+  ret = fat_updatefsinfo(fs);
+
+errout_with_lock:
+  nxmutex_unlock(&fs->fs_lock);
+  return ret;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -340,6 +340,12 @@
 
 #define UMOUNT_FORCED        8
 
+/* Sector cache slot flags (fc_flags) */
+
+#define FATCACHE_VALID       1 /* Slot holds fc_sector */
+#define FATCACHE_DIRTY       2 /* Slot must be written back */
+#define FATCACHE_AHEAD       4 /* Read ahead and not yet used */
+
 /****************************************************************************
  * These offset describe the FSINFO sector
  */
@@ -862,6 +868,19 @@
  * is mounted with a fat32 filesystem.
  */
 
+#ifdef CONFIG_FAT_LRUCACHE
+/* This structure describes one sector retained in the mountpoint sector
+ * cache in addition to the sector held in fs_buffer.
+ */
+
+struct fat_cache_s
+{
+  off_t    fc_sector;              /* The sector held in this slot */
+  uint32_t fc_stamp;               /* Value of fs_cacheclock at last use */
+  uint8_t  fc_flags;               /* See FATCACHE_* definitions */
+};
+#endif
+
 struct fat_file_s;
 struct fat_mountpt_s
 {
@@ -891,6 +910,15 @@ struct fat_mountpt_s
   uint8_t  fs_fatsecperclus;       /* MBR: Sectors per allocation unit: 2**n, n=0..7 */
   uint8_t *fs_buffer;              /* This is an allocated buffer to hold one
                                     * sector from the device */
+#ifdef CONFIG_FAT_LRUCACHE
+  uint8_t *fs_cachebuf;            /* Sector buffers of the fs_cache slots */
+  off_t    fs_cachenext;           /* Sector following the last cache miss */
+  uint32_t fs_cacheclock;          /* Incremented on each cache access */
+  struct fat_cache_s fs_cache[CONFIG_FAT_LRUCACHE_NSECTORS];
+#endif
+#ifdef CONFIG_FAT_FREEMAP
+  uint32_t *fs_freemap;            /* One bit per cluster, set when in use */
+#endif
 };
 
 /* This structure represents on open file under the mountpoint.  An instance
@@ -1091,6 +1119,14 @@ EXTERN int    fat_remove(FAR struct fat_mountpt_s *fs,
 
 /* Mountpoint and file buffer cache (for partial sector accesses) */
 
+#ifdef CONFIG_FAT_LRUCACHE
+EXTERN int    fat_cacheinitialize(FAR struct fat_mountpt_s *fs);
+EXTERN void   fat_cacheuninitialize(FAR struct fat_mountpt_s *fs);
+EXTERN void   fat_cacheinvalidate(FAR struct fat_mountpt_s *fs,
+                                  FAR const uint8_t *buffer, off_t sector,
+                                  unsigned int nsectors);
+#endif
+
 EXTERN int    fat_fscacheflush(FAR struct fat_mountpt_s *fs);
 EXTERN int    fat_fscacheread(FAR struct fat_mountpt_s *fs, off_t sector);
 EXTERN int    fat_ffcacheflush(FAR struct fat_mountpt_s *fs,
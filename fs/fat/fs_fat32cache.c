@@ -0,0 +1,515 @@
+/****************************************************************************
+ * fs/fat/fs_fat32cache.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+
+#include <nuttx/fs/fs.h>
+
+#include "fs_fat32.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#if CONFIG_FAT_LRUCACHE_READAHEAD >= CONFIG_FAT_LRUCACHE_NSECTORS
+#  error CONFIG_FAT_LRUCACHE_READAHEAD must be less than the number of sectors
+#endif
+
+#define FATCACHE_NSLOTS CONFIG_FAT_LRUCACHE_NSECTORS
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: fat_cachebuffer
+ *
+ * Description:
+ *   Return the sector buffer of a cache slot
+ *
+ ****************************************************************************/
+
+static inline FAR uint8_t *fat_cachebuffer(FAR struct fat_mountpt_s *fs,
+                                           int index)
+{
+  return fs->fs_cachebuf + index * fs->fs_hwsectorsize;
+}
+
+/****************************************************************************
+ * Name: fat_cacherank
+ *
+ * Description:
+ *   Return how valuable the contents of a slot are:  0 for an empty slot,
+ *   1 for a sector that was read ahead but never used and 2 otherwise.
+ *   Slots of lower rank are replaced first.
+ *
+ ****************************************************************************/
+
+static inline int fat_cacherank(FAR struct fat_cache_s *slot)
+{
+  if ((slot->fc_flags & FATCACHE_VALID) == 0)
+    {
+      return 0;
+    }
+
+  return (slot->fc_flags & FATCACHE_AHEAD) != 0 ? 1 : 2;
+}
+
+/****************************************************************************
+ * Name: fat_cachefind
+ *
+ * Description:
+ *   Return the index of the slot holding 'sector' or -1 if the sector is
+ *   not cached.
+ *
+ ****************************************************************************/
+
+static int fat_cachefind(FAR struct fat_mountpt_s *fs, off_t sector)
+{
+  int i;
+
+  for (i = 0; i < FATCACHE_NSLOTS; i++)
+    {
+      if ((fs->fs_cache[i].fc_flags & FATCACHE_VALID) != 0 &&
+          fs->fs_cache[i].fc_sector == sector)
+        {
+          return i;
+        }
+    }
+
+  return -1;
+}
+
+/****************************************************************************
+ * Name: fat_cachewrite
+ *
+ * Description:
+ *   Write one sector back to the device and, if it lies in the FAT, to
+ *   every copy of the FAT.
+ *
+ ****************************************************************************/
+
+static int fat_cachewrite(FAR struct fat_mountpt_s *fs,
+                          FAR uint8_t *buffer, off_t sector)
+{
+  int ret;
+  int i;
+
+  ret = fat_hwwrite(fs, buffer, sector, 1);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  if (sector >= fs->fs_fatbase &&
+      sector < fs->fs_fatbase + fs->fs_nfatsects)
+    {
+      for (i = fs->fs_fatnumfats; i >= 2; i--)
+        {
+          sector += fs->fs_nfatsects;
+          ret = fat_hwwrite(fs, buffer, sector, 1);
+          if (ret < 0)
+            {
+              return ret;
+            }
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: fat_cacheevict
+ *
+ * Description:
+ *   Empty a slot, writing its sector back first if it is dirty.
+ *
+ ****************************************************************************/
+
+static int fat_cacheevict(FAR struct fat_mountpt_s *fs, int index)
+{
+  FAR struct fat_cache_s *slot = &fs->fs_cache[index];
+  int ret;
+
+  if ((slot->fc_flags & (FATCACHE_VALID | FATCACHE_DIRTY)) ==
+      (FATCACHE_VALID | FATCACHE_DIRTY))
+    {
+      ret = fat_cachewrite(fs, fat_cachebuffer(fs, index), slot->fc_sector);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  slot->fc_flags = 0;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: fat_cachevictim
+ *
+ * Description:
+ *   Select the slot to be replaced:  the least recently used slot of the
+ *   lowest rank, never the slot 'skip'.
+ *
+ ****************************************************************************/
+
+static int fat_cachevictim(FAR struct fat_mountpt_s *fs, int skip)
+{
+  uint32_t bestage  = 0;
+  int      bestrank = 3;
+  int      best     = -1;
+  int      i;
+
+  for (i = 0; i < FATCACHE_NSLOTS; i++)
+    {
+      FAR struct fat_cache_s *slot = &fs->fs_cache[i];
+      uint32_t age = fs->fs_cacheclock - slot->fc_stamp;
+      int rank;
+
+      if (i == skip)
+        {
+          continue;
+        }
+
+      rank = fat_cacherank(slot);
+      if (rank < bestrank || (rank == bestrank && age > bestage))
+        {
+          bestrank = rank;
+          bestage  = age;
+          best     = i;
+        }
+    }
+
+  return best;
+}
+
+/****************************************************************************
+ * Name: fat_cachefill
+ *
+ * Description:
+ *   Read 'sector' into fs_buffer.  If the previous miss was on the sector
+ *   just before this one, also read the following sectors into a run of
+ *   slots with the same request.
+ *
+ ****************************************************************************/
+
+static int fat_cachefill(FAR struct fat_mountpt_s *fs, off_t sector)
+{
+#if CONFIG_FAT_LRUCACHE_READAHEAD > 0
+  int nahead = 0;
+  int start  = 0;
+  int i;
+
+  if (sector == fs->fs_cachenext)
+    {
+      int bestcost = INT_MAX;
+
+      /* Do not read past the end of the volume or re-read a sector that
+       * is already cached.
+       */
+
+      while (nahead < CONFIG_FAT_LRUCACHE_READAHEAD &&
+             sector + nahead + 1 < fs->fs_hwnsectors &&
+             fat_cachefind(fs, sector + nahead + 1) < 0)
+        {
+          nahead++;
+        }
+
+      /* Find the run of nahead + 1 slots that is the cheapest to give
+       * up.
+       */
+
+      for (i = 0; nahead > 0 && i + nahead < FATCACHE_NSLOTS; i++)
+        {
+          int cost = 0;
+          int j;
+
+          for (j = i; j <= i + nahead; j++)
+            {
+              cost += fat_cacherank(&fs->fs_cache[j]);
+            }
+
+          if (cost < bestcost)
+            {
+              bestcost = cost;
+              start    = i;
+            }
+        }
+    }
+
+  if (nahead > 0)
+    {
+      int ret;
+
+      for (i = start; i <= start + nahead; i++)
+        {
+          ret = fat_cacheevict(fs, i);
+          if (ret < 0)
+            {
+              return ret;
+            }
+        }
+
+      ret = fat_hwread(fs, fat_cachebuffer(fs, start), sector, nahead + 1);
+      if (ret >= 0)
+        {
+          memcpy(fs->fs_buffer, fat_cachebuffer(fs, start),
+                 fs->fs_hwsectorsize);
+
+          for (i = 1; i <= nahead; i++)
+            {
+              FAR struct fat_cache_s *slot = &fs->fs_cache[start + i];
+
+              slot->fc_sector = sector + i;
+              slot->fc_stamp  = fs->fs_cacheclock;
+              slot->fc_flags  = FATCACHE_VALID | FATCACHE_AHEAD;
+            }
+
+          fs->fs_cachenext = sector + nahead + 1;
+          return OK;
+        }
+
+      /* The device may not like the longer request, read only the sector
+       * that was asked for.
+       */
+    }
+#endif
+
+  fs->fs_cachenext = sector + 1;
+  return fat_hwread(fs, fs->fs_buffer, sector, 1);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: fat_cacheinitialize
+ *
+ * Description:
+ *   Allocate the sector cache of a mountpoint.  fs_hwsectorsize must be
+ *   known.
+ *
+ ****************************************************************************/
+
+int fat_cacheinitialize(FAR struct fat_mountpt_s *fs)
+{
+  fs->fs_cachebuf = (FAR uint8_t *)
+    fat_io_alloc(FATCACHE_NSLOTS * fs->fs_hwsectorsize);
+  if (fs->fs_cachebuf == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  memset(fs->fs_cache, 0, sizeof(fs->fs_cache));
+  fs->fs_currentsector = -1;
+  fs->fs_cachenext     = -1;
+  fs->fs_cacheclock    = 0;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: fat_cacheuninitialize
+ *
+ * Description:
+ *   Free the sector cache of a mountpoint without writing anything back.
+ *
+ ****************************************************************************/
+
+void fat_cacheuninitialize(FAR struct fat_mountpt_s *fs)
+{
+  if (fs->fs_cachebuf != NULL)
+    {
+      fat_io_free(fs->fs_cachebuf, FATCACHE_NSLOTS * fs->fs_hwsectorsize);
+      fs->fs_cachebuf = NULL;
+    }
+}
+
+/****************************************************************************
+ * Name: fat_cacheinvalidate
+ *
+ * Description:
+ *   Called after sectors were written to the device from 'buffer'.  Any
+ *   other cached copy of these sectors is stale now and is discarded.
+ *   fs_buffer itself is left alone.
+ *
+ ****************************************************************************/
+
+void fat_cacheinvalidate(FAR struct fat_mountpt_s *fs,
+                         FAR const uint8_t *buffer, off_t sector,
+                         unsigned int nsectors)
+{
+  int i;
+
+  for (i = 0; i < FATCACHE_NSLOTS; i++)
+    {
+      FAR struct fat_cache_s *slot = &fs->fs_cache[i];
+
+      if ((slot->fc_flags & FATCACHE_VALID) != 0 &&
+          slot->fc_sector >= sector && slot->fc_sector < sector + nsectors &&
+          fat_cachebuffer(fs, i) != buffer)
+        {
+          slot->fc_flags = 0;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: fat_fscacheflush
+ *
+ * Description:
+ *   Write back fs_buffer and every other dirty sector held in the cache.
+ *
+ ****************************************************************************/
+
+int fat_fscacheflush(struct fat_mountpt_s *fs)
+{
+  int ret;
+  int i;
+
+  /* fs_buffer may have been filled directly by the caller.  In that case
+   * any copy of the same sector in the slots is older.
+   */
+
+  i = fat_cachefind(fs, fs->fs_currentsector);
+  if (i >= 0)
+    {
+      fs->fs_cache[i].fc_flags = 0;
+    }
+
+  if (fs->fs_dirty)
+    {
+      ret = fat_cachewrite(fs, fs->fs_buffer, fs->fs_currentsector);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      fs->fs_dirty = false;
+    }
+
+  for (i = 0; i < FATCACHE_NSLOTS; i++)
+    {
+      FAR struct fat_cache_s *slot = &fs->fs_cache[i];
+
+      if ((slot->fc_flags & FATCACHE_DIRTY) != 0)
+        {
+          ret = fat_cachewrite(fs, fat_cachebuffer(fs, i), slot->fc_sector);
+          if (ret < 0)
+            {
+              return ret;
+            }
+
+          slot->fc_flags &= ~FATCACHE_DIRTY;
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: fat_fscacheread
+ *
+ * Description:
+ *   Make the specified sector the one held in fs_buffer.  The sector that
+ *   was there before is retained in the cache, dirty or not, replacing the
+ *   least recently used sector.
+ *
+ ****************************************************************************/
+
+int fat_fscacheread(struct fat_mountpt_s *fs, off_t sector)
+{
+  FAR struct fat_cache_s *slot;
+  int hit;
+  int ret;
+  int i;
+
+  if (fs->fs_currentsector == sector)
+    {
+      return OK;
+    }
+
+  fs->fs_cacheclock++;
+  hit = fat_cachefind(fs, sector);
+
+  /* Move the current sector out of fs_buffer into a slot */
+
+  if (fs->fs_currentsector >= 0)
+    {
+      i = fat_cachefind(fs, fs->fs_currentsector);
+      if (i >= 0)
+        {
+          fs->fs_cache[i].fc_flags = 0;
+        }
+
+      i   = fat_cachevictim(fs, hit);
+      ret = fat_cacheevict(fs, i);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      slot = &fs->fs_cache[i];
+      memcpy(fat_cachebuffer(fs, i), fs->fs_buffer, fs->fs_hwsectorsize);
+      slot->fc_sector = fs->fs_currentsector;
+      slot->fc_stamp  = fs->fs_cacheclock;
+      slot->fc_flags  = FATCACHE_VALID;
+      if (fs->fs_dirty)
+        {
+          slot->fc_flags |= FATCACHE_DIRTY;
+          fs->fs_dirty    = false;
+        }
+    }
+
+  /* Then bring in the requested sector, from a slot if it is there */
+
+  if (hit >= 0)
+    {
+      slot = &fs->fs_cache[hit];
+      memcpy(fs->fs_buffer, fat_cachebuffer(fs, hit), fs->fs_hwsectorsize);
+      fs->fs_dirty   = (slot->fc_flags & FATCACHE_DIRTY) != 0;
+      slot->fc_flags = 0;
+    }
+  else
+    {
+      ret = fat_cachefill(fs, sector);
+      if (ret < 0)
+        {
+          /* fs_buffer holds nothing valid now */
+
+          fs->fs_currentsector = -1;
+          return ret;
+        }
+    }
+
+  fs->fs_currentsector = sector;
+  return OK;
+}
@@ -32,6 +32,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <time.h>
 #include <assert.h>
 #include <errno.h>
@@ -270,6 +271,100 @@ static int fat_checkbootrecord(struct fat_mountpt_s *fs)
   return OK;
 }
 
+#ifdef CONFIG_FAT_FREEMAP
+/****************************************************************************
+ * Name: fat_freemapbuild
+ *
+ * Description:
+ *   Allocate the free cluster bitmap and fill it from the FAT.  Since this
+ *   examines every cluster, the FSINFO free count is also brought up to
+ *   date.
+ *
+ ****************************************************************************/
+
+static int fat_freemapbuild(FAR struct fat_mountpt_s *fs)
+{
+  uint32_t nwords = (fs->fs_nclusters + 31) / 32;
+  uint32_t nfreeclusters = 0;
+  uint32_t cluster;
+  off_t    next;
+
+  fs->fs_freemap = fs_heap_zalloc(nwords * sizeof(uint32_t));
+  if (fs->fs_freemap == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  for (cluster = 0; cluster < fs->fs_nclusters; cluster++)
+    {
+      next = fat_getcluster(fs, cluster + 2);
+      if (next < 0)
+        {
+          fs_heap_free(fs->fs_freemap);
+          fs->fs_freemap = NULL;
+          return (int)next;
+        }
+      else if (next != 0)
+        {
+          fs->fs_freemap[cluster >> 5] |= UINT32_C(1) << (cluster & 31);
+        }
+      else
+        {
+          nfreeclusters++;
+        }
+    }
+
+  /* Never hand out the bits beyond the last cluster */
+
+  if ((fs->fs_nclusters & 31) != 0)
+    {
+      fs->fs_freemap[nwords - 1] |= UINT32_MAX << (fs->fs_nclusters & 31);
+    }
+
+  if (fs->fs_fsifreecount != nfreeclusters)
+    {
+      fs->fs_fsifreecount = nfreeclusters;
+      if (fs->fs_type == FSTYPE_FAT32)
+        {
+          fs->fs_fsidirty = true;
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: fat_freemapscan
+ *
+ * Description:
+ *   Return the index of the first clear bit in [first, last) of the free
+ *   cluster bitmap or -1 if there is none.
+ *
+ ****************************************************************************/
+
+static int32_t fat_freemapscan(FAR const uint32_t *map, uint32_t first,
+                               uint32_t last)
+{
+  while (first < last)
+    {
+      /* Treat the bits below 'first' in this word as in use */
+
+      uint32_t word = map[first >> 5] |
+                      ((UINT32_C(1) << (first & 31)) - 1);
+
+      if (word != UINT32_MAX)
+        {
+          first = (first & ~31) + ffs(~word) - 1;
+          return first < last ? (int32_t)first : -1;
+        }
+
+      first = (first | 31) + 1;
+    }
+
+  return -1;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -520,6 +615,16 @@ int fat_mount(struct fat_mountpt_s *fs, bool writeable)
       goto errout;
     }
 
+#ifdef CONFIG_FAT_LRUCACHE
+  /* And the sectors retained behind it */
+
+  ret = fat_cacheinitialize(fs);
+  if (ret < 0)
+    {
+      goto errout_with_buffer;
+    }
+#endif
+
   /* Search FAT boot record on the drive.  First check the MBR at sector
    * zero.  This could be either the boot record or a partition that refers
    * to the boot record.
@@ -658,6 +763,9 @@ int fat_mount(struct fat_mountpt_s *fs, bool writeable)
   return OK;
 
 errout_with_buffer:
+#ifdef CONFIG_FAT_LRUCACHE
+  fat_cacheuninitialize(fs);
+#endif
   fat_io_free(fs->fs_buffer, fs->fs_hwsectorsize);
   fs->fs_buffer = NULL;
 
@@ -775,6 +883,15 @@ int fat_hwwrite(struct fat_mountpt_s *fs, uint8_t *buffer, off_t sector,
         }
     }
 
+#ifdef CONFIG_FAT_LRUCACHE
+  /* Drop any copies of these sectors that the cache holds */
+
+  if (ret == OK)
+    {
+      fat_cacheinvalidate(fs, buffer, sector, nsectors);
+    }
+#endif
+
   return ret;
 }
 
@@ -1100,6 +1217,25 @@ int fat_putcluster(struct fat_mountpt_s *fs, uint32_t clusterno,
             return -EINVAL;
         }
 
+#ifdef CONFIG_FAT_FREEMAP
+      /* Keep the free cluster bitmap in step with the FAT */
+
+      if (fs->fs_freemap != NULL && clusterno >= 2)
+        {
+          uint32_t index = clusterno - 2;
+          uint32_t bit   = UINT32_C(1) << (index & 31);
+
+          if (nextcluster != 0)
+            {
+              fs->fs_freemap[index >> 5] |= bit;
+            }
+          else
+            {
+              fs->fs_freemap[index >> 5] &= ~bit;
+            }
+        }
+#endif
+
       /* Mark the modified sector as "dirty" and return success */
 
       fs->fs_dirty = true;
@@ -1231,56 +1367,87 @@ int32_t fat_extendchain(struct fat_mountpt_s *fs, uint32_t cluster)
    * the next cluster (return the new cluster number).
    */
 
-  newcluster = startcluster;
-  for (; ; )
+#ifdef CONFIG_FAT_FREEMAP
+  /* Use the free cluster bitmap, building it on first use.  If there is
+   * no memory for it, fall back to scanning the FAT.
+   */
+
+  if (fs->fs_freemap != NULL || fat_freemapbuild(fs) >= 0)
     {
-      /* Examine the next cluster in the FAT */
+      uint32_t first = startcluster - 1; /* Bit of startcluster + 1 */
+      int32_t  index;
 
-      newcluster++;
-      if (newcluster >= fs->fs_nclusters + 2)
+      if (first >= fs->fs_nclusters)
         {
-          /* If we hit the end of the available clusters, then
-           * wrap back to the beginning because we might have
-           * started at a non-optimal place.  But don't continue
-           * past the start cluster.
-           */
+          first = 0;
+        }
 
-          newcluster = 2;
-          if (newcluster > startcluster)
+      index = fat_freemapscan(fs->fs_freemap, first, fs->fs_nclusters);
+      if (index < 0)
+        {
+          index = fat_freemapscan(fs->fs_freemap, 0, first);
+          if (index < 0)
             {
-              /* We are back past the starting cluster, then there
-               * is no free cluster.
-               */
-
               return 0;
             }
         }
 
-      /* We have a candidate cluster.  Check if the cluster number is
-       * mapped to a group of sectors.
-       */
-
-      startsector = fat_getcluster(fs, newcluster);
-      if (startsector == 0)
+      newcluster = index + 2;
+    }
+  else
+#endif
+    {
+      newcluster = startcluster;
+      for (; ; )
         {
-          /* Found have found a free cluster break out */
+          /* Examine the next cluster in the FAT */
 
-          break;
-        }
-      else if (startsector < 0)
-        {
-          /* Some error occurred, return the error number */
+          newcluster++;
+          if (newcluster >= fs->fs_nclusters + 2)
+            {
+              /* If we hit the end of the available clusters, then
+               * wrap back to the beginning because we might have
+               * started at a non-optimal place.  But don't continue
+               * past the start cluster.
+               */
 
-          return startsector;
-        }
+              newcluster = 2;
+              if (newcluster > startcluster)
+                {
+                  /* We are back past the starting cluster, then there
+                   * is no free cluster.
+                   */
 
-      /* We wrap all the back to the starting cluster?  If so, then
-       * there are no free clusters.
-       */
+                  return 0;
+                }
+            }
 
-      if (newcluster == startcluster)
-        {
-          return 0;
+          /* We have a candidate cluster.  Check if the cluster number is
+           * mapped to a group of sectors.
+           */
+
+          startsector = fat_getcluster(fs, newcluster);
+          if (startsector == 0)
+            {
+              /* Found have found a free cluster break out */
+
+              break;
+            }
+          else if (startsector < 0)
+            {
+              /* Some error occurred, return the error number */
+
+              return startsector;
+            }
+
+          /* We wrap all the back to the starting cluster?  If so, then
+           * there are no free clusters.
+           */
+
+          if (newcluster == startcluster)
+            {
+              return 0;
+            }
         }
     }
 
@@ -1758,6 +1925,7 @@ int fat_dirextend(FAR struct fat_mountpt_s *fs, FAR struct fat_file_s *ff,
   return OK;
 }
 
+#ifndef CONFIG_FAT_LRUCACHE
 /****************************************************************************
  * Name: fat_fscacheflush
  *
@@ -1857,6 +2025,7 @@ int fat_fscacheread(struct fat_mountpt_s *fs, off_t sector)
 
   return OK;
 }
+#endif /* !CONFIG_FAT_LRUCACHE */
 
 /****************************************************************************
  * Name: fat_ffcacheflush
@@ -60,6 +60,10 @@ void inode_free(FAR struct inode *inode)
                   (inode->i_peer == NULL && inode->i_child == NULL));
 #endif
 
+#ifdef CONFIG_PSEUDOFS_HASH
+      inode_hash_remove(inode);
+#endif
+
       /* Free all peers and children of this i_node */
 
       inode_free(inode->i_peer);
@@ -0,0 +1,166 @@
+/****************************************************************************
+ * fs/inode/fs_inodehash.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <nuttx/fs/fs.h>
+
+#include "inode/inode.h"
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Inodes hashed by their parent and their name */
+
+static FAR struct inode *g_inode_hash[CONFIG_PSEUDOFS_HASH_NBUCKETS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: inode_hash_bucket
+ *
+ * Description:
+ *   Return the bucket for the node 'name' below 'parent'.  The name ends at
+ *   the first '/' or at the end of the string so that a path segment can be
+ *   looked up in place.
+ *
+ ****************************************************************************/
+
+static FAR struct inode **inode_hash_bucket(FAR const struct inode *parent,
+                                            FAR const char *name)
+{
+  uint32_t hash = (uint32_t)(uintptr_t)parent;
+
+  hash = (hash ^ (hash >> 16)) * 0x45d9f3b;
+  while (*name != '\0' && *name != '/')
+    {
+      hash = hash * 31 + (uint8_t)*name++;
+    }
+
+  return &g_inode_hash[hash % CONFIG_PSEUDOFS_HASH_NBUCKETS];
+}
+
+/****************************************************************************
+ * Name: inode_hash_match
+ *
+ * Description:
+ *   Return true if the path segment 'fname' equals the name of the inode.
+ *
+ ****************************************************************************/
+
+static bool inode_hash_match(FAR const char *fname,
+                             FAR const struct inode *inode)
+{
+  FAR const char *nname = inode->i_name;
+
+  while (*nname != '\0' && *fname == *nname)
+    {
+      fname++;
+      nname++;
+    }
+
+  return *nname == '\0' && (*fname == '\0' || *fname == '/');
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: inode_hash_insert
+ ****************************************************************************/
+
+void inode_hash_insert(FAR struct inode *inode)
+{
+  FAR struct inode **bucket = inode_hash_bucket(inode->i_parent,
+                                                inode->i_name);
+
+  inode->i_hash = *bucket;
+  *bucket       = inode;
+}
+
+/****************************************************************************
+ * Name: inode_hash_remove
+ ****************************************************************************/
+
+void inode_hash_remove(FAR struct inode *inode)
+{
+  FAR struct inode **link = inode_hash_bucket(inode->i_parent,
+                                              inode->i_name);
+
+  for (; *link != NULL; link = &(*link)->i_hash)
+    {
+      if (*link == inode)
+        {
+          *link = inode->i_hash;
+          break;
+        }
+    }
+
+  inode->i_hash = NULL;
+}
+
+/****************************************************************************
+ * Name: inode_hash_find
+ ****************************************************************************/
+
+FAR struct inode *inode_hash_find(FAR const struct inode *parent,
+                                  FAR const char *name)
+{
+  FAR struct inode *inode = *inode_hash_bucket(parent, name);
+
+  for (; inode != NULL; inode = inode->i_hash)
+    {
+      if (inode->i_parent == parent && inode_hash_match(name, inode))
+        {
+          break;
+        }
+    }
+
+  return inode;
+}
+
+/****************************************************************************
+ * Name: inode_hash_reparent
+ ****************************************************************************/
+
+void inode_hash_reparent(FAR struct inode *parent)
+{
+  FAR struct inode *child;
+
+  for (child = parent->i_child; child != NULL; child = child->i_peer)
+    {
+      inode_hash_remove(child);
+      child->i_parent = parent;
+      inode_hash_insert(child);
+    }
+}
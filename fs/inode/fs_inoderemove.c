@@ -91,6 +91,20 @@ static FAR struct inode *inode_unlink(FAR const char *path)
             }
         }
 
+#ifdef CONFIG_PSEUDOFS_HASH
+      /* A node found through the hash table comes without its left peer */
+
+      if (desc.peer == NULL && desc.parent != NULL &&
+          desc.parent->i_child != inode)
+        {
+          desc.peer = desc.parent->i_child;
+          while (desc.peer->i_peer != inode)
+            {
+              desc.peer = desc.peer->i_peer;
+            }
+        }
+#endif
+
       /* If peer is non-null, then remove the node from the right of
        * of that peer node.
        */
@@ -117,6 +131,10 @@ static FAR struct inode *inode_unlink(FAR const char *path)
           desc.parent->i_child = inode->i_peer;
         }
 
+#ifdef CONFIG_PSEUDOFS_HASH
+      inode_hash_remove(inode);
+#endif
+
       inode->i_peer   = NULL;
       inode->i_parent = NULL;
       atomic_fetch_sub(&inode->i_crefs, 1);
@@ -142,6 +142,10 @@ static void inode_insert(FAR struct inode *inode,
       inode->i_parent = parent;
       parent->i_child = inode;
     }
+
+#ifdef CONFIG_PSEUDOFS_HASH
+  inode_hash_insert(inode);
+#endif
 }
 
 /****************************************************************************
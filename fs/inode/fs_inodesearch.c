@@ -242,7 +242,26 @@ static int _inode_search(FAR struct inode_search_s *desc)
 
   while (inode != NULL)
     {
-      int result = _inode_compare(name, inode);
+      int result;
+
+#ifdef CONFIG_PSEUDOFS_HASH
+      /* At the head of each level, look the name up in the hash table
+       * rather than walking the peers.  The sorted list is still walked
+       * when the name is not there so that inode_reserve() gets the node
+       * to the "left" of the insertion point.
+       */
+
+      if (above != NULL && left == NULL)
+        {
+          FAR struct inode *found = inode_hash_find(above, name);
+          if (found != NULL)
+            {
+              inode = found;
+            }
+        }
+#endif
+
+      result = _inode_compare(name, inode);
 
       /* Case 1:  The name is less than the name of the node.
        * Since the names are ordered, these means that there
@@ -109,7 +109,9 @@
  *  node     - INPUT:  (not used)
  *             OUTPUT: On success, holds the pointer to the inode found.
  *  peer     - INPUT:  (not used)
- *             OUTPUT: The inode to the "left" of the inode found.
+ *             OUTPUT: The inode to the "left" of the inode found.  With
+ *                     CONFIG_PSEUDOFS_HASH, this is only set when the
+ *                     terminal node was not found.
  *  parent   - INPUT:  (not used)
  *             OUTPUT: The inode to the "above" of the inode found.
  *  relpath  - INPUT:  (not used)
@@ -334,6 +336,29 @@ int inode_getpath(FAR struct inode *inode, FAR char *path, size_t len);
 
 void inode_free(FAR struct inode *inode);
 
+/****************************************************************************
+ * Name: inode_hash_insert, inode_hash_remove, inode_hash_find and
+ *       inode_hash_reparent
+ *
+ * Description:
+ *   Maintain the hash table used to look up an inode from its parent and
+ *   its name.  inode_hash_remove() does nothing if the inode is not in the
+ *   table.  inode_hash_reparent() sets the parent of all children of an
+ *   inode to that inode and rehashes them.
+ *
+ * Assumptions/Limitations:
+ *   The caller must hold the inode tree lock.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_PSEUDOFS_HASH
+void inode_hash_insert(FAR struct inode *inode);
+void inode_hash_remove(FAR struct inode *inode);
+FAR struct inode *inode_hash_find(FAR const struct inode *parent,
+                                  FAR const char *name);
+void inode_hash_reparent(FAR struct inode *parent);
+#endif
+
 /****************************************************************************
  * Name: inode_nextname
  *
@@ -223,6 +223,33 @@ static ssize_t iobinfo_read(FAR struct file *filep, FAR char *buffer,
                              &offset);
   totalsize += copysize;
 
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+  buffer    += copysize;
+  buflen    -= copysize;
+
+  /* The large I/O buffer size class is reported separately */
+
+  linesize   = procfs_snprintf(iobfile->line, IOBINFO_LINELEN,
+                               "%10s%10s%10s\n",
+                               "lbufsize", "ltotal", "lfree");
+
+  copysize   = procfs_memcpy(iobfile->line, linesize, buffer, buflen,
+                             &offset);
+  totalsize += copysize;
+
+  buffer    += copysize;
+  buflen    -= copysize;
+
+  linesize   = procfs_snprintf(iobfile->line, IOBINFO_LINELEN,
+                               "%10d%10d%10d\n",
+                               stats.nlargesize, stats.nlargetotal,
+                               stats.nlargefree);
+
+  copysize   = procfs_memcpy(iobfile->line, linesize, buffer, buflen,
+                             &offset);
+  totalsize += copysize;
+#endif
+
   /* Update the file offset */
 
   filep->f_pos += totalsize;
@@ -622,6 +622,36 @@ static int romfs_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
           return -ENXIO;
         }
     }
+  else if (cmd == FIOC_GETEXTENT)
+    {
+      FAR struct romfs_mountpt_s *rm = filep->f_inode->i_private;
+      FAR struct file_extent_s *ext =
+        (FAR struct file_extent_s *)((uintptr_t)arg);
+
+      if (rm->rm_xipbase == NULL)
+        {
+          return -ENXIO;
+        }
+
+      if (ext->fe_offset < 0)
+        {
+          return -EINVAL;
+        }
+
+      /* The whole file is contiguous in the XIP image */
+
+      if (ext->fe_offset >= rf->rf_size)
+        {
+          ext->fe_length = 0;
+        }
+      else if (ext->fe_length > rf->rf_size - ext->fe_offset)
+        {
+          ext->fe_length = rf->rf_size - ext->fe_offset;
+        }
+
+      ext->fe_base = rm->rm_xipbase + rf->rf_startoffset + ext->fe_offset;
+      return OK;
+    }
 
   return -ENOTTY;
 }
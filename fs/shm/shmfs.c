@@ -45,6 +45,7 @@ static ssize_t shmfs_read(FAR struct file *filep, FAR char *buffer,
                           size_t buflen);
 static ssize_t shmfs_write(FAR struct file *filep, FAR const char *buffer,
                            size_t buflen);
+static int shmfs_ioctl(FAR struct file *filep, int cmd, unsigned long arg);
 static int shmfs_truncate(FAR struct file *filep, off_t length);
 
 #ifndef CONFIG_DISABLE_PSEUDOFS_OPERATIONS
@@ -69,7 +70,7 @@ const struct file_operations g_shmfs_operations =
   shmfs_read,       /* read */
   shmfs_write,      /* write */
   NULL,             /* seek */
-  NULL,             /* ioctl */
+  shmfs_ioctl,      /* ioctl */
   shmfs_mmap,       /* mmap */
   shmfs_truncate,   /* truncate */
   NULL,             /* poll */
@@ -209,6 +210,43 @@ static int shmfs_close(FAR struct file *filep)
   return shmfs_release(filep->f_inode);
 }
 
+/****************************************************************************
+ * Name: shmfs_ioctl
+ ****************************************************************************/
+
+static int shmfs_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
+{
+#ifndef CONFIG_BUILD_KERNEL
+  if (cmd == FIOC_GETEXTENT)
+    {
+      FAR struct shmfs_object_s *sho = filep->f_inode->i_private;
+      FAR struct file_extent_s *ext =
+        (FAR struct file_extent_s *)((uintptr_t)arg);
+
+      /* Outside of the kernel build the object is one allocation */
+
+      if (sho == NULL || ext->fe_offset < 0)
+        {
+          return -EINVAL;
+        }
+
+      if (ext->fe_offset >= sho->length)
+        {
+          ext->fe_length = 0;
+        }
+      else if (ext->fe_length > sho->length - ext->fe_offset)
+        {
+          ext->fe_length = sho->length - ext->fe_offset;
+        }
+
+      ext->fe_base = (FAR char *)sho->paddr + ext->fe_offset;
+      return OK;
+    }
+#endif
+
+  return -ENOTTY;
+}
+
 /****************************************************************************
  * Name: shmfs_truncate
  ****************************************************************************/
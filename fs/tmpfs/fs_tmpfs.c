@@ -26,6 +26,7 @@
 
 #include <nuttx/config.h>
 
+#include <sys/param.h>
 #include <sys/stat.h>
 #include <sys/statfs.h>
 #include <stdint.h>
@@ -54,7 +55,10 @@
 #  warning CONFIG_FS_TMPFS_DIRECTORY_FREEGUARD needs to be > ALLOCGUARD
 #endif
 
-#if CONFIG_FS_TMPFS_FILE_FREEGUARD <= CONFIG_FS_TMPFS_FILE_ALLOCGUARD
+#ifdef CONFIG_FS_TMPFS_PAGED
+#  define TMPFS_PAGESIZE    CONFIG_FS_TMPFS_PAGESIZE
+#  define TMPFS_NPAGES(s)   (((s) + TMPFS_PAGESIZE - 1) / TMPFS_PAGESIZE)
+#elif CONFIG_FS_TMPFS_FILE_FREEGUARD <= CONFIG_FS_TMPFS_FILE_ALLOCGUARD
 #  warning CONFIG_FS_TMPFS_FILE_FREEGUARD needs to be > ALLOCGUARD
 #endif
 
@@ -94,11 +98,23 @@ struct tmpfs_dir_s
 
 static int  tmpfs_realloc_directory(FAR struct tmpfs_directory_s *tdo,
               unsigned int nentries);
+static void tmpfs_free_data(FAR struct tmpfs_file_s *tfo);
+static void tmpfs_read_data(FAR struct tmpfs_file_s *tfo, off_t pos,
+                            FAR char *buffer, size_t len);
+static int  tmpfs_write_data(FAR struct tmpfs_file_s *tfo, off_t pos,
+                             FAR const char *buffer, size_t len);
 static int  tmpfs_realloc_file(FAR struct tmpfs_file_s *tfo,
               size_t newsize);
 static void tmpfs_release_lockedobject(FAR struct tmpfs_object_s *to);
 static void tmpfs_release_lockedfile(FAR struct tmpfs_file_s *tfo);
 static int  tmpfs_release_file(FAR struct tmpfs_file_s *tfo);
+#ifdef CONFIG_FS_TMPFS_DIRECTORY_HASH
+static uint32_t tmpfs_hash_name(FAR const char *name, size_t len);
+static void tmpfs_hash_link(FAR struct tmpfs_directory_s *tdo, int index);
+static void tmpfs_hash_unlink(FAR struct tmpfs_directory_s *tdo,
+                              int index);
+static int tmpfs_hash_grow(FAR struct tmpfs_directory_s *tdo);
+#endif
 static int  tmpfs_find_dirent(FAR struct tmpfs_directory_s *tdo,
               FAR const char *name, size_t len);
 static int  tmpfs_remove_dirent(FAR struct tmpfs_directory_s *tdo,
@@ -285,10 +301,229 @@ static int tmpfs_realloc_directory(FAR struct tmpfs_directory_s *tdo,
   return ret;
 }
 
+#ifdef CONFIG_FS_TMPFS_PAGED
+/****************************************************************************
+ * Name: tmpfs_get_page
+ *
+ * Description:
+ *   Return data page 'index' of the file, allocating it if the page is
+ *   still a hole.  Returns NULL if the page can not be allocated.
+ *
+ ****************************************************************************/
+
+static FAR uint8_t *tmpfs_get_page(FAR struct tmpfs_file_s *tfo,
+                                   size_t index)
+{
+  FAR uint8_t *page = tfo->tfo_pages[index];
+
+  if (page == NULL)
+    {
+      page = fs_heap_zalloc(TMPFS_PAGESIZE);
+      if (page != NULL)
+        {
+          tfo->tfo_pages[index] = page;
+          tfo->tfo_alloc += TMPFS_PAGESIZE;
+        }
+    }
+
+  return page;
+}
+#endif
+
+/****************************************************************************
+ * Name: tmpfs_free_data
+ ****************************************************************************/
+
+static void tmpfs_free_data(FAR struct tmpfs_file_s *tfo)
+{
+#ifdef CONFIG_FS_TMPFS_PAGED
+  size_t i;
+
+  for (i = 0; i < tfo->tfo_slots; i++)
+    {
+      fs_heap_free(tfo->tfo_pages[i]);
+    }
+
+  fs_heap_free(tfo->tfo_pages);
+  tfo->tfo_pages = NULL;
+  tfo->tfo_slots = 0;
+#else
+  fs_heap_free(tfo->tfo_data);
+  tfo->tfo_data  = NULL;
+#endif
+  tfo->tfo_alloc = 0;
+  tfo->tfo_size  = 0;
+}
+
+/****************************************************************************
+ * Name: tmpfs_read_data
+ *
+ * Description:
+ *   Copy 'len' bytes at 'pos' out of the file.  The range must lie within
+ *   the file.
+ *
+ ****************************************************************************/
+
+static void tmpfs_read_data(FAR struct tmpfs_file_s *tfo, off_t pos,
+                            FAR char *buffer, size_t len)
+{
+#ifdef CONFIG_FS_TMPFS_PAGED
+  while (len > 0)
+    {
+      FAR uint8_t *page = tfo->tfo_pages[pos / TMPFS_PAGESIZE];
+      size_t offset = pos % TMPFS_PAGESIZE;
+      size_t ncopy = MIN(len, TMPFS_PAGESIZE - offset);
+
+      /* Holes read back as zeroes */
+
+      if (page != NULL)
+        {
+          memcpy(buffer, page + offset, ncopy);
+        }
+      else
+        {
+          memset(buffer, 0, ncopy);
+        }
+
+      buffer += ncopy;
+      pos    += ncopy;
+      len    -= ncopy;
+    }
+#else
+  if (tfo->tfo_data != NULL)
+    {
+      memcpy(buffer, &tfo->tfo_data[pos], len);
+    }
+  else
+    {
+      DEBUGASSERT(tfo->tfo_size == 0 && len == 0);
+    }
+#endif
+}
+
+/****************************************************************************
+ * Name: tmpfs_write_data
+ *
+ * Description:
+ *   Copy 'len' bytes into the file at 'pos'.  The range must lie within
+ *   the file.
+ *
+ ****************************************************************************/
+
+static int tmpfs_write_data(FAR struct tmpfs_file_s *tfo, off_t pos,
+                            FAR const char *buffer, size_t len)
+{
+#ifdef CONFIG_FS_TMPFS_PAGED
+  while (len > 0)
+    {
+      FAR uint8_t *page = tmpfs_get_page(tfo, pos / TMPFS_PAGESIZE);
+      size_t offset = pos % TMPFS_PAGESIZE;
+      size_t ncopy = MIN(len, TMPFS_PAGESIZE - offset);
+
+      if (page == NULL)
+        {
+          return -ENOMEM;
+        }
+
+      memcpy(page + offset, buffer, ncopy);
+
+      buffer += ncopy;
+      pos    += ncopy;
+      len    -= ncopy;
+    }
+#else
+  if (tfo->tfo_data != NULL)
+    {
+      memcpy(&tfo->tfo_data[pos], buffer, len);
+    }
+  else
+    {
+      DEBUGASSERT(tfo->tfo_size == 0 && len == 0);
+    }
+#endif
+
+  return OK;
+}
+
 /****************************************************************************
  * Name: tmpfs_realloc_file
  ****************************************************************************/
 
+#ifdef CONFIG_FS_TMPFS_PAGED
+static int tmpfs_realloc_file(FAR struct tmpfs_file_s *tfo,
+                              size_t newsize)
+{
+  FAR uint8_t **newpages;
+  size_t npages;
+  size_t nslots;
+  size_t i;
+
+  if (newsize > SIZE_MAX - TMPFS_PAGESIZE)
+    {
+      return -ENOMEM;
+    }
+
+  npages = TMPFS_NPAGES(newsize);
+
+  if (newsize == 0)
+    {
+      tmpfs_free_data(tfo);
+      return OK;
+    }
+  else if (newsize < tfo->tfo_size)
+    {
+      /* Shrinking ... Free the pages past the new end of file and clear
+       * the tail of the last page, so that the old data does not reappear
+       * if the file grows again.
+       */
+
+      for (i = npages; i < tfo->tfo_slots; i++)
+        {
+          if (tfo->tfo_pages[i] != NULL)
+            {
+              fs_heap_free(tfo->tfo_pages[i]);
+              tfo->tfo_pages[i] = NULL;
+              tfo->tfo_alloc -= TMPFS_PAGESIZE;
+            }
+        }
+
+      if (newsize % TMPFS_PAGESIZE != 0 &&
+          tfo->tfo_pages[npages - 1] != NULL)
+        {
+          memset(tfo->tfo_pages[npages - 1] + newsize % TMPFS_PAGESIZE,
+                 0, TMPFS_PAGESIZE - newsize % TMPFS_PAGESIZE);
+        }
+    }
+  else if (npages > tfo->tfo_slots)
+    {
+      /* Growing ... Only the page table is extended, and only that is
+       * copied.  The new pages are holes until they are first written.
+       */
+
+      nslots = MAX(npages, 2 * tfo->tfo_slots);
+      if (nslots > SIZE_MAX / sizeof(FAR uint8_t *))
+        {
+          return -ENOMEM;
+        }
+
+      newpages = fs_heap_realloc(tfo->tfo_pages,
+                                 nslots * sizeof(FAR uint8_t *));
+      if (newpages == NULL)
+        {
+          return -ENOMEM;
+        }
+
+      memset(&newpages[tfo->tfo_slots], 0,
+             (nslots - tfo->tfo_slots) * sizeof(FAR uint8_t *));
+
+      tfo->tfo_pages = newpages;
+      tfo->tfo_slots = nslots;
+    }
+
+  tfo->tfo_size = newsize;
+  return OK;
+}
+#else
 static int tmpfs_realloc_file(FAR struct tmpfs_file_s *tfo,
                               size_t newsize)
 {
@@ -362,6 +597,7 @@ static int tmpfs_realloc_file(FAR struct tmpfs_file_s *tfo,
   tfo->tfo_data  = newdata;
   return OK;
 }
+#endif
 
 /****************************************************************************
  * Name: tmpfs_release_lockedobject
@@ -400,7 +636,7 @@ static void tmpfs_release_lockedfile(FAR struct tmpfs_file_s *tfo)
     {
       tmpfs_unlock_file(tfo);
       nxrmutex_destroy(&tfo->tfo_lock);
-      fs_heap_free(tfo->tfo_data);
+      tmpfs_free_data(tfo);
       fs_heap_free(tfo);
     }
 
@@ -435,6 +671,113 @@ static int tmpfs_release_file(FAR struct tmpfs_file_s *tfo)
   return OK;
 }
 
+#ifdef CONFIG_FS_TMPFS_DIRECTORY_HASH
+/****************************************************************************
+ * Name: tmpfs_hash_name
+ ****************************************************************************/
+
+static uint32_t tmpfs_hash_name(FAR const char *name, size_t len)
+{
+  uint32_t hash = 0;
+
+  while (len-- > 0)
+    {
+      hash = hash * 31 + (uint8_t)*name++;
+    }
+
+  return hash;
+}
+
+/****************************************************************************
+ * Name: tmpfs_hash_link
+ *
+ * Description:
+ *   Add directory entry 'index' to its hash bucket.
+ *
+ ****************************************************************************/
+
+static void tmpfs_hash_link(FAR struct tmpfs_directory_s *tdo, int index)
+{
+  FAR struct tmpfs_dirent_s *tde = &tdo->tdo_entry[index];
+  FAR int *bucket;
+
+  if (tdo->tdo_hash != NULL)
+    {
+      bucket        = &tdo->tdo_hash[tde->tde_hash % tdo->tdo_nbuckets];
+      tde->tde_next = *bucket;
+      *bucket       = index;
+    }
+}
+
+/****************************************************************************
+ * Name: tmpfs_hash_unlink
+ *
+ * Description:
+ *   Remove directory entry 'index' from its hash bucket.
+ *
+ ****************************************************************************/
+
+static void tmpfs_hash_unlink(FAR struct tmpfs_directory_s *tdo,
+                              int index)
+{
+  FAR struct tmpfs_dirent_s *tde = &tdo->tdo_entry[index];
+  FAR int *link;
+
+  if (tdo->tdo_hash != NULL)
+    {
+      link = &tdo->tdo_hash[tde->tde_hash % tdo->tdo_nbuckets];
+      while (*link != index)
+        {
+          DEBUGASSERT(*link >= 0);
+          link = &tdo->tdo_entry[*link].tde_next;
+        }
+
+      *link = tde->tde_next;
+    }
+}
+
+/****************************************************************************
+ * Name: tmpfs_hash_grow
+ *
+ * Description:
+ *   Double the number of hash buckets once the directory holds more
+ *   entries than buckets, and rehash all entries.  On failure the table is
+ *   left unchanged and the caller links the new entry into it; the old
+ *   table then stays in use with longer chains, and without any table
+ *   tmpfs_find_dirent() falls back to a linear search.
+ *
+ ****************************************************************************/
+
+static int tmpfs_hash_grow(FAR struct tmpfs_directory_s *tdo)
+{
+  FAR int *newhash;
+  uint32_t nbuckets;
+  uint32_t i;
+
+  nbuckets = tdo->tdo_nbuckets > 0 ? 2 * tdo->tdo_nbuckets : 8;
+  newhash  = fs_heap_realloc(tdo->tdo_hash, nbuckets * sizeof(int));
+  if (newhash == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  tdo->tdo_hash     = newhash;
+  tdo->tdo_nbuckets = nbuckets;
+
+  for (i = 0; i < nbuckets; i++)
+    {
+      newhash[i] = -1;
+    }
+
+  for (i = 0; i < tdo->tdo_nentries; i++)
+    {
+      tmpfs_hash_link(tdo, i);
+    }
+
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Name: tmpfs_find_dirent
  ****************************************************************************/
@@ -458,6 +801,28 @@ static int tmpfs_find_dirent(FAR struct tmpfs_directory_s *tdo,
         }
     }
 
+#ifdef CONFIG_FS_TMPFS_DIRECTORY_HASH
+  if (tdo->tdo_hash != NULL)
+    {
+      uint32_t hash = tmpfs_hash_name(name, len);
+
+      /* Only walk the bucket the name hashes to */
+
+      for (i = tdo->tdo_hash[hash % tdo->tdo_nbuckets]; i >= 0;
+           i = tdo->tdo_entry[i].tde_next)
+        {
+          if (tdo->tdo_entry[i].tde_hash == hash &&
+              strncmp(tdo->tdo_entry[i].tde_name, name, len) == 0 &&
+              tdo->tdo_entry[i].tde_name[len] == '\0')
+            {
+              return i;
+            }
+        }
+
+      return -ENOENT;
+    }
+#endif
+
   /* Search the list of directory entries for a match */
 
   for (i = 0;
@@ -499,10 +864,20 @@ static int tmpfs_remove_dirent(FAR struct tmpfs_directory_s *tdo,
   /* Remove by replacing this entry with the final directory entry */
 
   last = tdo->tdo_nentries - 1;
+#ifdef CONFIG_FS_TMPFS_DIRECTORY_HASH
+  tmpfs_hash_unlink(tdo, index);
+  if (index != last)
+    {
+      tmpfs_hash_unlink(tdo, last);
+      tdo->tdo_entry[index] = tdo->tdo_entry[last];
+      tmpfs_hash_link(tdo, index);
+    }
+#else
   if (index != last)
     {
       tdo->tdo_entry[index] = tdo->tdo_entry[last];
     }
+#endif
 
   /* And decrement the count of directory entries */
 
@@ -569,6 +944,19 @@ static int tmpfs_add_dirent(FAR struct tmpfs_directory_s *tdo,
   tde->tde_object = to;
   tde->tde_name   = newname;
 
+#ifdef CONFIG_FS_TMPFS_DIRECTORY_HASH
+  tde->tde_hash   = tmpfs_hash_name(newname, namelen);
+
+  /* Growing the table rehashes the new entry as well.  If it can not be
+   * grown, the entry still goes into the existing table.
+   */
+
+  if (nentries <= tdo->tdo_nbuckets || tmpfs_hash_grow(tdo) < 0)
+    {
+      tmpfs_hash_link(tdo, index);
+    }
+#endif
+
   return OK;
 }
 
@@ -749,7 +1137,12 @@ tmpfs_alloc_file(FAR struct tmpfs_directory_s *parent, mode_t mode)
   tfo->tfo_parent = parent;
   tfo->tfo_flags  = 0;
   tfo->tfo_size   = 0;
+#ifdef CONFIG_FS_TMPFS_PAGED
+  tfo->tfo_pages  = NULL;
+  tfo->tfo_slots  = 0;
+#else
   tfo->tfo_data   = NULL;
+#endif
 
 #ifdef CONFIG_FS_PERMISSION
   tmpfs_init_object((FAR struct tmpfs_object_s *)tfo, mode);
@@ -905,6 +1298,10 @@ tmpfs_alloc_directory(FAR struct tmpfs_directory_s *parent, mode_t mode)
   tdo->tdo_parent   = parent;
   tdo->tdo_nentries = 0;
   tdo->tdo_entry    = NULL;
+#ifdef CONFIG_FS_TMPFS_DIRECTORY_HASH
+  tdo->tdo_nbuckets = 0;
+  tdo->tdo_hash     = NULL;
+#endif
 
 #ifdef CONFIG_FS_PERMISSION
   tmpfs_init_object((FAR struct tmpfs_object_s *)tdo, mode);
@@ -1368,7 +1765,11 @@ static int tmpfs_statfs_callout(FAR struct tmpfs_directory_s *tdo,
 
       tmptfo             = (FAR struct tmpfs_file_s *)to;
       tmpbuf->tsf_alloc += sizeof(struct tmpfs_file_s);
-      tmpbuf->tsf_avail += to->to_alloc - tmptfo->tfo_size;
+      if (to->to_alloc > tmptfo->tfo_size)
+        {
+          tmpbuf->tsf_avail += to->to_alloc - tmptfo->tfo_size;
+        }
+
       tmpbuf->tsf_files++;
     }
   else /* if (to->to_type == TMPFS_DIRECTORY) */
@@ -1417,11 +1818,21 @@ static int tmpfs_free_callout(FAR struct tmpfs_directory_s *tdo,
   to   = tde->tde_object;
   last = tdo->tdo_nentries - 1;
 
+#ifdef CONFIG_FS_TMPFS_DIRECTORY_HASH
+  tmpfs_hash_unlink(tdo, index);
+#endif
+
   if (index != last)
     {
       /* Move the directory entry */
 
+#ifdef CONFIG_FS_TMPFS_DIRECTORY_HASH
+      tmpfs_hash_unlink(tdo, last);
       *tde = tdo->tdo_entry[last];
+      tmpfs_hash_link(tdo, index);
+#else
+      *tde = tdo->tdo_entry[last];
+#endif
     }
 
   /* And decrement the count of directory entries */
@@ -1444,13 +1855,16 @@ static int tmpfs_free_callout(FAR struct tmpfs_directory_s *tdo,
           return TMPFS_UNLINKED;
         }
 
-      fs_heap_free(tfo->tfo_data);
+      tmpfs_free_data(tfo);
     }
   else /* if (to->to_type == TMPFS_DIRECTORY) */
     {
       tdo = (FAR struct tmpfs_directory_s *)to;
 
       fs_heap_free(tdo->tdo_entry);
+#ifdef CONFIG_FS_TMPFS_DIRECTORY_HASH
+      fs_heap_free(tdo->tdo_hash);
+#endif
     }
 
   /* Free the object now */
@@ -1786,15 +2200,8 @@ static ssize_t tmpfs_read(FAR struct file *filep, FAR char *buffer,
 
   /* Copy data from the memory object to the user buffer */
 
-  if (tfo->tfo_data != NULL)
-    {
-      memcpy(buffer, &tfo->tfo_data[startpos], nread);
-      filep->f_pos += nread;
-    }
-  else
-    {
-      DEBUGASSERT(tfo->tfo_size == 0 && nread == 0);
-    }
+  tmpfs_read_data(tfo, startpos, buffer, nread);
+  filep->f_pos += nread;
 
   /* Release the lock on the file */
 
@@ -1811,6 +2218,7 @@ static ssize_t tmpfs_write(FAR struct file *filep, FAR const char *buffer,
 {
   FAR struct tmpfs_file_s *tfo;
   ssize_t nwritten;
+  size_t oldsize;
   off_t startpos;
   off_t endpos;
   int ret;
@@ -1844,6 +2252,7 @@ static ssize_t tmpfs_write(FAR struct file *filep, FAR const char *buffer,
 
   nwritten = buflen;
   endpos   = startpos + buflen;
+  oldsize  = tfo->tfo_size;
 
   if (endpos > tfo->tfo_size)
     {
@@ -1856,15 +2265,19 @@ static ssize_t tmpfs_write(FAR struct file *filep, FAR const char *buffer,
         }
     }
 
-  /* Copy data from the memory object to the user buffer */
+  /* Copy data from the user buffer to the memory object */
 
-  if (tfo->tfo_data != NULL)
-    {
-      memcpy(&tfo->tfo_data[startpos], buffer, nwritten);
-    }
-  else
+  ret = tmpfs_write_data(tfo, startpos, buffer, nwritten);
+  if (ret < 0)
     {
-      DEBUGASSERT(tfo->tfo_size == 0 && nwritten == 0);
+      /* Out of pages, undo the size change */
+
+      if (endpos > oldsize)
+        {
+          tmpfs_realloc_file(tfo, oldsize);
+        }
+
+      goto errout_with_lock;
     }
 
   filep->f_pos = endpos;
@@ -1988,7 +2401,32 @@ static int tmpfs_mmap(FAR struct file *filep, FAR struct mm_map_entry_s *map)
   if (map->offset >= 0 && map->offset < tfo->tfo_size &&
       map->length && map->offset + map->length <= tfo->tfo_size)
     {
+#ifdef CONFIG_FS_TMPFS_PAGED
+      FAR uint8_t *page;
+
+      /* Only a range within one page is contiguous in memory.  Anything
+       * larger is left to the generic rammap() fallback.
+       */
+
+      if (map->offset / TMPFS_PAGESIZE !=
+          (map->offset + map->length - 1) / TMPFS_PAGESIZE)
+        {
+          return -ENOTTY;
+        }
+
+      tmpfs_lock_file(tfo);
+      page = tmpfs_get_page(tfo, map->offset / TMPFS_PAGESIZE);
+      tmpfs_unlock_file(tfo);
+
+      if (page == NULL)
+        {
+          return -ENOMEM;
+        }
+
+      map->vaddr = page + map->offset % TMPFS_PAGESIZE;
+#else
       map->vaddr = tfo->tfo_data + map->offset;
+#endif
       map->priv.p = tfo;
       map->munmap = tmpfs_unmap;
       ret = mm_map_add(get_current_mm(), map);
@@ -2042,7 +2480,92 @@ static int tmpfs_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
     {
       FAR uintptr_t *ptr = (FAR uintptr_t *)arg;
 
+#ifdef CONFIG_FS_TMPFS_PAGED
+      /* Only a file that fits into one page is contiguous */
+
+      if (tfo->tfo_size > TMPFS_PAGESIZE)
+        {
+          return -ENOTTY;
+        }
+
+      *ptr = 0;
+      if (tfo->tfo_size > 0)
+        {
+          tmpfs_lock_file(tfo);
+          *ptr = (uintptr_t)tmpfs_get_page(tfo, 0);
+          tmpfs_unlock_file(tfo);
+        }
+#else
       *ptr = (uintptr_t)tfo->tfo_data;
+#endif
+      return OK;
+    }
+  else if (cmd == FIOC_GETEXTENT)
+    {
+      FAR struct file_extent_s *ext =
+        (FAR struct file_extent_s *)((uintptr_t)arg);
+      size_t remain;
+
+      if (ext->fe_offset < 0)
+        {
+          return -EINVAL;
+        }
+
+      ret = tmpfs_lock_file(tfo);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      remain = ext->fe_offset < tfo->tfo_size ?
+               tfo->tfo_size - ext->fe_offset : 0;
+
+#ifdef CONFIG_FS_TMPFS_PAGED
+      /* Only the rest of the page is contiguous.  A page that was never
+       * written has no memory behind it; leave that to read().
+       */
+
+      if (remain > 0)
+        {
+          size_t pgoff = ext->fe_offset % TMPFS_PAGESIZE;
+          FAR uint8_t *page;
+
+          page = tfo->tfo_pages[ext->fe_offset / TMPFS_PAGESIZE];
+          if (page == NULL)
+            {
+              tmpfs_unlock_file(tfo);
+              return -ENXIO;
+            }
+
+          ext->fe_base = page + pgoff;
+          if (remain > TMPFS_PAGESIZE - pgoff)
+            {
+              remain = TMPFS_PAGESIZE - pgoff;
+            }
+        }
+#else
+      ext->fe_base = tfo->tfo_data + ext->fe_offset;
+#endif
+
+      if (ext->fe_length > remain)
+        {
+          ext->fe_length = remain;
+        }
+
+      /* A write or truncate could move or free the data, so the file stays
+       * locked until the extent is released with FIOC_PUTEXTENT.
+       */
+
+      if (ext->fe_length == 0)
+        {
+          tmpfs_unlock_file(tfo);
+        }
+
+      return OK;
+    }
+  else if (cmd == FIOC_PUTEXTENT)
+    {
+      tmpfs_unlock_file(tfo);
       return OK;
     }
 
@@ -2206,14 +2729,16 @@ static int tmpfs_truncate(FAR struct file *filep, off_t length)
           goto errout_with_lock;
         }
 
+#ifndef CONFIG_FS_TMPFS_PAGED
       /* If the size has increased, then we need to zero the newly added
-       * memory.
+       * memory.  Pages are already zero past the end of the file.
        */
 
       if (length > oldsize)
         {
           memset(&tfo->tfo_data[oldsize], 0, length - oldsize);
         }
+#endif
 
       ret = OK;
     }
@@ -2501,6 +3026,9 @@ static int tmpfs_unbind(FAR void *handle, FAR struct inode **blkdriver,
 
   nxrmutex_destroy(&tdo->tdo_lock);
   fs_heap_free(tdo->tdo_entry);
+#ifdef CONFIG_FS_TMPFS_DIRECTORY_HASH
+  fs_heap_free(tdo->tdo_hash);
+#endif
   fs_heap_free(tdo);
 
   nxrmutex_destroy(&fs->tfs_lock);
@@ -2667,7 +3195,7 @@ static int tmpfs_unlink(FAR struct inode *mountpt, FAR const char *relpath)
   else
     {
       nxrmutex_destroy(&tfo->tfo_lock);
-      fs_heap_free(tfo->tfo_data);
+      tmpfs_free_data(tfo);
       fs_heap_free(tfo);
     }
 
@@ -2810,6 +3338,9 @@ static int tmpfs_rmdir(FAR struct inode *mountpt, FAR const char *relpath)
 
   nxrmutex_destroy(&tdo->tdo_lock);
   fs_heap_free(tdo->tdo_entry);
+#ifdef CONFIG_FS_TMPFS_DIRECTORY_HASH
+  fs_heap_free(tdo->tdo_hash);
+#endif
   fs_heap_free(tdo);
 
   /* Release the reference and lock on the parent directory */
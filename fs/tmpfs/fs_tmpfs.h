@@ -72,6 +72,10 @@ struct tmpfs_dirent_s
 {
   FAR struct tmpfs_object_s *tde_object;
   FAR char *tde_name;
+#ifdef CONFIG_FS_TMPFS_DIRECTORY_HASH
+  uint32_t tde_hash;     /* Hash of tde_name */
+  int      tde_next;     /* Next entry in the same hash bucket or -1 */
+#endif
 };
 
 /* The generic form of a TMPFS memory object */
@@ -113,6 +117,10 @@ struct tmpfs_directory_s
 
   uint16_t tdo_nentries; /* Number of directory entries */
   FAR struct tmpfs_dirent_s *tdo_entry;
+#ifdef CONFIG_FS_TMPFS_DIRECTORY_HASH
+  uint32_t tdo_nbuckets; /* Number of hash buckets */
+  FAR int *tdo_hash;     /* First entry in each bucket or -1 */
+#endif
 };
 
 #define SIZEOF_TMPFS_DIRECTORY(n) ((n) * sizeof(struct tmpfs_dirent_s))
@@ -145,7 +153,12 @@ struct tmpfs_file_s
 
   uint8_t       tfo_flags; /* See TFO_FLAG_* definitions */
   size_t        tfo_size;  /* Valid file size */
+#ifdef CONFIG_FS_TMPFS_PAGED
+  FAR uint8_t **tfo_pages; /* Data pages, NULL entries are holes */
+  size_t        tfo_slots; /* Number of entries in tfo_pages */
+#else
   FAR uint8_t  *tfo_data;  /* File data starts here */
+#endif
 };
 
 /* This structure represents one instance of a TMPFS file system */
@@ -247,6 +247,12 @@ static int pseudorename(FAR const char *oldpath, FAR struct inode *oldinode,
       goto errout_with_lock;
     }
 
+#ifdef CONFIG_PSEUDOFS_HASH
+  /* The children are now looked up under the new inode */
+
+  inode_hash_reparent(newinode);
+#endif
+
   /* Remove all of the children from the unlinked inode */
 
   oldinode->i_child  = NULL;
@@ -32,6 +32,7 @@
 #include <nuttx/debug.h>
 
 #include <nuttx/fs/fs.h>
+#include <nuttx/fs/ioctl.h>
 #include <nuttx/kmalloc.h>
 #include <nuttx/net/net.h>
 #include "fs_heap.h"
@@ -43,9 +44,11 @@
 static ssize_t copyfile(FAR struct file *outfile, FAR struct file *infile,
                         FAR off_t *offset, size_t count)
 {
-  FAR uint8_t *iobuffer;
-  FAR uint8_t *wrbuffer;
+  FAR uint8_t *iobuffer = NULL;
+  FAR const uint8_t *wrbuffer;
+  struct file_extent_s ext;
   off_t startpos = 0;
+  off_t extpos;
   ssize_t nbytesread;
   ssize_t nbyteswritten;
   size_t  ntransferred;
@@ -74,65 +77,126 @@ static ssize_t copyfile(FAR struct file *outfile, FAR struct file *infile,
         }
     }
 
-  /* Allocate an I/O buffer */
+  /* File systems that keep the file data in memory report where it lies
+   * with FIOC_GETEXTENT and the data is written from there directly.  The
+   * position is tracked here and handed back to the file once the extents
+   * run out (or the transfer ends).  The extent may keep the file locked
+   * until it is released, so writing back into the same file must read.
+   */
 
-  iobuffer = fs_heap_malloc(CONFIG_SENDFILE_BUFSIZE);
-  if (!iobuffer)
+  extpos = -1;
+  if (outfile->f_inode != infile->f_inode)
     {
-      return -ENOMEM;
+      extpos = file_seek(infile, 0, SEEK_CUR);
     }
 
   /* Now transfer 'count' bytes from the infile to the outfile */
 
   for (ntransferred = 0, endxfr = false; ntransferred < count && !endxfr; )
     {
-      /* Loop until the read side of the transfer comes to some conclusion */
-
-      do
+      ext.fe_length = 0;
+      if (extpos >= 0)
         {
-          /* Read a buffer of data from the infile */
+          ext.fe_offset = extpos;
+          ext.fe_length = count - ntransferred;
 
-          nbytesread = count - ntransferred;
-          if (nbytesread > CONFIG_SENDFILE_BUFSIZE)
+          if (file_ioctl(infile, FIOC_GETEXTENT, &ext) >= 0)
             {
-              nbytesread = CONFIG_SENDFILE_BUFSIZE;
+              if (ext.fe_length == 0)
+                {
+                  break;
+                }
+
+              wrbuffer   = ext.fe_base;
+              nbytesread = ext.fe_length;
             }
+          else
+            {
+              /* Continue with read() from where the extents ended */
 
-          nbytesread = file_read(infile, iobuffer, nbytesread);
+              ext.fe_length = 0;
+              extpos = file_seek(infile, extpos, SEEK_SET);
+              if (extpos < 0)
+                {
+                  ntransferred = extpos;
+                  break;
+                }
 
-          /* Check for end of file */
+              extpos = -1;
+            }
+        }
 
-          if (nbytesread == 0)
-            {
-              /* End of file.  Break out and return current number of bytes
-               * transferred.
-               */
+      /* Otherwise read the next buffer of data from the infile */
 
-              endxfr = true;
-              break;
+      if (extpos < 0)
+        {
+          /* Allocate an I/O buffer */
+
+          if (iobuffer == NULL)
+            {
+              iobuffer = fs_heap_malloc(CONFIG_SENDFILE_BUFSIZE);
+              if (iobuffer == NULL)
+                {
+                  ntransferred = -ENOMEM;
+                  break;
+                }
             }
 
-          /* Check for a read ERROR.  EINTR is a special case.  This function
-           * should break out and return an error if EINTR is returned and
-           * no data has been transferred.  But what should it do if some
-           * data has been transferred?  I suppose just continue?
+          /* Loop until the read side of the transfer comes to some
+           * conclusion
            */
 
-          else if (nbytesread < 0)
+          do
             {
-              /* EINTR is not an error (but will still stop the copy) */
+              /* Read a buffer of data from the infile */
+
+              nbytesread = count - ntransferred;
+              if (nbytesread > CONFIG_SENDFILE_BUFSIZE)
+                {
+                  nbytesread = CONFIG_SENDFILE_BUFSIZE;
+                }
+
+              nbytesread = file_read(infile, iobuffer, nbytesread);
+
+              /* Check for end of file */
 
-              if (nbytesread != -EINTR || ntransferred == 0)
+              if (nbytesread == 0)
                 {
-                  /* Read error.  Break out and return the error condition. */
+                  /* End of file.  Break out and return current number of
+                   * bytes transferred.
+                   */
 
-                  ntransferred = nbytesread;
-                  endxfr       = true;
+                  endxfr = true;
                   break;
                 }
+
+              /* Check for a read ERROR.  EINTR is a special case.  This
+               * function should break out and return an error if EINTR is
+               * returned and no data has been transferred.  But what should
+               * it do if some data has been transferred?  I suppose just
+               * continue?
+               */
+
+              else if (nbytesread < 0)
+                {
+                  /* EINTR is not an error (but will still stop the copy) */
+
+                  if (nbytesread != -EINTR || ntransferred == 0)
+                    {
+                      /* Read error.  Break out and return the error
+                       * condition.
+                       */
+
+                      ntransferred = nbytesread;
+                      endxfr       = true;
+                      break;
+                    }
+                }
             }
+          while (nbytesread < 0);
+
+          wrbuffer = iobuffer;
         }
-      while (nbytesread < 0);
 
       /* Was anything read? */
 
@@ -142,7 +206,6 @@ static ssize_t copyfile(FAR struct file *outfile, FAR struct file *infile,
            * conclusion.
            */
 
-          wrbuffer = iobuffer;
           do
             {
               /* Write the buffer of data to the outfile */
@@ -168,6 +231,10 @@ static ssize_t copyfile(FAR struct file *outfile, FAR struct file *infile,
                    */
 
                   ntransferred += nbyteswritten;
+                  if (extpos >= 0)
+                    {
+                      extpos += nbyteswritten;
+                    }
                 }
 
               /* Otherwise an error occurred */
@@ -195,11 +262,32 @@ static ssize_t copyfile(FAR struct file *outfile, FAR struct file *infile,
             }
           while (nbytesread > 0);
         }
+
+      /* Release the extent written from */
+
+      if (ext.fe_length > 0)
+        {
+          file_ioctl(infile, FIOC_PUTEXTENT, &ext);
+        }
     }
 
   /* Release the I/O buffer */
 
-  fs_heap_free(iobuffer);
+  if (iobuffer != NULL)
+    {
+      fs_heap_free(iobuffer);
+    }
+
+  /* Move the file position past the data sent from the extents */
+
+  if (extpos >= 0)
+    {
+      extpos = file_seek(infile, extpos, SEEK_SET);
+      if (extpos < 0 && (ssize_t)ntransferred >= 0)
+        {
+          ntransferred = extpos;
+        }
+    }
 
   /* Return the current file position */
 
@@ -59,4 +59,64 @@
 #define TCP_MAXSEG    (__SO_PROTOCOL + 4) /* The maximum segment size */
 #define TCP_CORK      (__SO_PROTOCOL + 5) /* Coalescing of small segments */
 
+/* Congestion control algorithm.  Argument: name string */
+
+#define TCP_CONGESTION (__SO_PROTOCOL + 6)
+
+/* Connection state and statistics.  Argument: struct tcp_info */
+
+#define TCP_INFO      (__SO_PROTOCOL + 7)
+
+/* Values for the tcpi_options field of struct tcp_info */
+
+#define TCPI_OPT_TIMESTAMPS 1
+#define TCPI_OPT_SACK       2
+#define TCPI_OPT_WSCALE     4
+
+/****************************************************************************
+ * Public Type Definitions
+ ****************************************************************************/
+
+/* Returned by the TCP_INFO socket option.  The layout is the one of the
+ * leading fields of the Linux structure; the fields that NuttX does not
+ * track are reported as zero.  Times are in microseconds.
+ */
+
+struct tcp_info
+{
+  uint8_t  tcpi_state;          /* TCP state, see nuttx/net/tcp.h */
+  uint8_t  tcpi_ca_state;
+  uint8_t  tcpi_retransmits;    /* Retransmissions of the last segment */
+  uint8_t  tcpi_probes;
+  uint8_t  tcpi_backoff;
+  uint8_t  tcpi_options;        /* TCPI_OPT_* negotiated options */
+  uint8_t  tcpi_snd_wscale : 4; /* Window scale of the peer */
+  uint8_t  tcpi_rcv_wscale : 4; /* Our window scale */
+  uint8_t  tcpi_reserved;
+
+  uint32_t tcpi_rto;            /* Retransmission timeout */
+  uint32_t tcpi_ato;
+  uint32_t tcpi_snd_mss;        /* Maximum segment size to send */
+  uint32_t tcpi_rcv_mss;
+  uint32_t tcpi_unacked;        /* Segments sent but not acknowledged */
+  uint32_t tcpi_sacked;
+  uint32_t tcpi_lost;
+  uint32_t tcpi_retrans;
+  uint32_t tcpi_fackets;
+
+  uint32_t tcpi_last_data_sent;
+  uint32_t tcpi_last_ack_sent;
+  uint32_t tcpi_last_data_recv;
+  uint32_t tcpi_last_ack_recv;
+
+  uint32_t tcpi_pmtu;
+  uint32_t tcpi_rcv_ssthresh;
+  uint32_t tcpi_rtt;            /* Smoothed round trip time */
+  uint32_t tcpi_rttvar;         /* Round trip time variation */
+  uint32_t tcpi_snd_ssthresh;   /* Slow start threshold (segments) */
+  uint32_t tcpi_snd_cwnd;       /* Congestion window (segments) */
+  uint32_t tcpi_advmss;
+  uint32_t tcpi_reordering;
+};
+
 #endif /* __INCLUDE_NETINET_TCP_H */
@@ -48,9 +48,35 @@
 
 #define PACKET_ADD_MEMBERSHIP  1 /* Add a multicast address to the interface */
 #define PACKET_DROP_MEMBERSHIP 2 /* Drop a multicast address from the interface */
+#define PACKET_RX_RING         5 /* Set up the memory-mapped receive ring */
+#define PACKET_TX_RING        13 /* Set up the memory-mapped transmit ring */
 
 #define PACKET_MR_MULTICAST    0 /* Multicast address */
 
+/* Values of tp_status in the frames of a receive ring */
+
+#define TP_STATUS_KERNEL       0        /* Frame is owned by the kernel */
+#define TP_STATUS_USER         (1 << 0) /* Frame holds data for the user */
+#define TP_STATUS_LOSING       (1 << 2) /* Frames were dropped before this */
+
+/* Values of tp_status in the frames of a transmit ring */
+
+#define TP_STATUS_AVAILABLE    0        /* Frame is free for the user */
+#define TP_STATUS_SEND_REQUEST (1 << 0) /* Frame is queued for sending */
+#define TP_STATUS_SENDING      (1 << 1) /* Frame is being sent */
+#define TP_STATUS_WRONG_FORMAT (1 << 2) /* Frame was rejected */
+
+/* Each frame starts with a struct tpacket2_hdr.  In a receive ring the
+ * header is followed by a struct sockaddr_ll and the frame data is found at
+ * tp_mac; in a transmit ring the data starts right after the aligned header.
+ */
+
+#define TPACKET_ALIGNMENT      16
+#define TPACKET_ALIGN(x)       (((x) + TPACKET_ALIGNMENT - 1) & \
+                                ~(TPACKET_ALIGNMENT - 1))
+#define TPACKET2_HDRLEN        (TPACKET_ALIGN(sizeof(struct tpacket2_hdr)) + \
+                                sizeof(struct sockaddr_ll))
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -74,4 +100,33 @@ struct packet_mreq
   unsigned char  mr_address[8];
 };
 
+/* Frame header of the memory-mapped rings */
+
+struct tpacket2_hdr
+{
+  uint32_t       tp_status;    /* TP_STATUS_* ownership of the frame */
+  uint32_t       tp_len;       /* Length of the packet on the wire */
+  uint32_t       tp_snaplen;   /* Number of bytes stored in the frame */
+  uint16_t       tp_mac;       /* Offset of the link layer header */
+  uint16_t       tp_net;       /* Offset of the network layer header */
+  uint32_t       tp_sec;       /* Receive time stamp, seconds */
+  uint32_t       tp_nsec;      /* Receive time stamp, nanoseconds */
+  uint16_t       tp_vlan_tci;
+  uint16_t       tp_vlan_tpid;
+  uint8_t        tp_padding[4];
+};
+
+/* Argument of PACKET_RX_RING and PACKET_TX_RING.  The ring is made of
+ * tp_block_nr blocks of tp_block_size bytes, each holding a whole number of
+ * tp_frame_size byte frames.  A tp_block_nr of zero releases the ring.
+ */
+
+struct tpacket_req
+{
+  unsigned int   tp_block_size;
+  unsigned int   tp_block_nr;
+  unsigned int   tp_frame_size;
+  unsigned int   tp_frame_nr;
+};
+
 #endif /* __INCLUDE_NETPACKET_PACKET_H */
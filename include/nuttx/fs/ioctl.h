@@ -282,6 +282,15 @@
                                            * OUT: Releases one pin
                                            */
 
+#define FIOC_GETEXTENT      _FIOC(0x001f) /* IN:  FAR struct file_extent_s *
+                                           * OUT: Address and length of the
+                                           *      file data at fe_offset
+                                           */
+#define FIOC_PUTEXTENT      _FIOC(0x0020) /* IN:  FAR struct file_extent_s *
+                                           *      from FIOC_GETEXTENT
+                                           * OUT: Releases the extent
+                                           */
+
 /* NuttX character driver ioctl definitions *********************************/
 
 #define _DIOCVALID(c)   (_IOC_TYPE(c)==_DIOCBASE)
@@ -890,6 +899,24 @@ struct pipe_peek_s
   size_t size;
 };
 
+/* Argument to the FIOC_GETEXTENT ioctl.  File systems whose data already
+ * lies in addressable memory report where the data at fe_offset is, so that
+ * it can be sent without first reading it into a buffer.  fe_length is
+ * reduced to the number of contiguous bytes at fe_base, and to zero at the
+ * end of the file.  A file system whose data may be moved or freed while
+ * the file is open (tmpfs) keeps it in place until the same extent is
+ * handed back with FIOC_PUTEXTENT, so a caller that got a non-zero
+ * fe_length must issue FIOC_PUTEXTENT, from the same thread, as soon as it
+ * is done with fe_base.  Other file systems need not answer FIOC_PUTEXTENT.
+ */
+
+struct file_extent_s
+{
+  off_t            fe_offset;  /* IN:  File offset of the data */
+  size_t           fe_length;  /* IN:  Bytes wanted; OUT: bytes at fe_base */
+  FAR const void  *fe_base;    /* OUT: Address of the byte at fe_offset */
+};
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
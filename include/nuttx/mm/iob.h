@@ -80,7 +80,7 @@
 /* IOB helpers */
 
 #define IOB_DATA(p)      (&(p)->io_data[(p)->io_offset])
-#define IOB_FREESPACE(p) (CONFIG_IOB_BUFSIZE - (p)->io_len - (p)->io_offset)
+#define IOB_FREESPACE(p) (IOB_BUFSIZE(p) - (p)->io_len - (p)->io_offset)
 
 #if CONFIG_IOB_NCHAINS > 0
 /* Queue helpers */
@@ -95,6 +95,16 @@
 #  define IOB_BUFSIZE(p) CONFIG_IOB_BUFSIZE
 #endif
 
+/* The large I/O buffer size class */
+
+#ifndef CONFIG_IOB_LARGE_NBUFFERS
+#  define CONFIG_IOB_LARGE_NBUFFERS 0
+#endif
+
+#if CONFIG_IOB_LARGE_NBUFFERS > 0 && !defined(CONFIG_IOB_ALLOC)
+#  error CONFIG_IOB_LARGE_NBUFFERS requires CONFIG_IOB_ALLOC
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -167,6 +177,11 @@ struct iob_stats_s
   int nfree;
   int nwait;
   int nthrottle;
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+  int nlargesize;   /* Payload size of the large I/O buffers */
+  int nlargetotal;  /* Number of large I/O buffers */
+  int nlargefree;   /* Number of free large I/O buffers */
+#endif
 };
 
 /****************************************************************************
@@ -220,6 +235,25 @@ FAR struct iob_s *iob_alloc(bool throttled);
 
 FAR struct iob_s *iob_tryalloc(bool throttled);
 
+/****************************************************************************
+ * Name: iob_alloc_len/iob_tryalloc_len
+ *
+ * Description:
+ *   Allocate the I/O buffer of the best size class for 'len' bytes of
+ *   payload.  A large I/O buffer is taken if 'len' exceeds
+ *   CONFIG_IOB_BUFSIZE and one is free; otherwise this is the same as
+ *   iob_alloc()/iob_tryalloc().  The caller must still be prepared to
+ *   chain further I/O buffers, as with iob_alloc().
+ *
+ * Input Parameters:
+ *   throttled - An indication of the IOB allocation is "throttled"
+ *   len       - The number of payload bytes that are going to be added
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *iob_alloc_len(bool throttled, unsigned int len);
+FAR struct iob_s *iob_tryalloc_len(bool throttled, unsigned int len);
+
 #ifdef CONFIG_IOB_ALLOC
 /****************************************************************************
  * Name: iob_alloc_dynamic
@@ -49,6 +49,10 @@
 #  define MEMPOOL_REALBLOCKSIZE(pool) ((pool)->blocksize)
 #endif
 
+#ifndef CONFIG_MM_MEMPOOL_CPUCACHE
+#  define CONFIG_MM_MEMPOOL_CPUCACHE 0
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -87,6 +91,16 @@ struct mempool_procfs_entry_s
 };
 #endif
 
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+/* This structure describes the per-CPU cache of free blocks of a pool */
+
+struct mempool_cpucache_s
+{
+  sq_queue_t queue;   /* The free blocks cached by this CPU */
+  size_t     count;   /* The number of blocks in queue */
+};
+#endif
+
 /* This structure describes memory buffer pool */
 
 struct mempool_s
@@ -110,6 +124,9 @@ struct mempool_s
   size_t     nalloc;  /* The number of used block in mempool */
   spinlock_t lock;    /* The protect lock to mempool */
   sem_t      waitsem; /* The semaphore of waiter get free block */
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+  struct mempool_cpucache_s cache[CONFIG_SMP_NCPUS]; /* The per-CPU caches */
+#endif
 #if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_MEMPOOL)
   struct mempool_procfs_entry_s procfs; /* The entry of procfs */
 #endif
@@ -159,6 +159,12 @@
 #define SIOCGIFVLAN        _SIOC(0x0043)  /* Get VLAN interface */
 #define SIOCSIFVLAN        _SIOC(0x0044)  /* Set VLAN interface */
 
+/* Zero-copy receive ********************************************************/
+
+#define SIOCZCRELEASE      _SIOC(0x0045)  /* Return the buffers lent by
+                                           * recvmsg(MSG_ZCRECV); arg is
+                                           * msg_iov[0].iov_base */
+
 /****************************************************************************
  * Public Type Definitions
  ****************************************************************************/
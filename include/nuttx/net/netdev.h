@@ -84,6 +84,8 @@
 
 #define NETDEV_TX_CSUM  (1 << 1) /* Netdev support hardware tx checksum */
 #define NETDEV_RX_CSUM  (1 << 2) /* Netdev support hardware rx checksum */
+#define NETDEV_TX_TSO   (1 << 3) /* Netdev cuts TCP/IPv4 frames at the MTU */
+#define NETDEV_RX_GRO   (1 << 4) /* Netdev rx TCP segments may be merged */
 
 /* Determine the largest possible address */
 
@@ -861,6 +863,30 @@ uint16_t chksum(uint16_t sum, FAR const uint8_t *data, uint16_t len);
 
 uint16_t chksum_iob(uint16_t sum, FAR struct iob_s *iob, uint16_t offset);
 
+/****************************************************************************
+ * Name: up_chksum_words
+ *
+ * Description:
+ *   Sum the native-endian 16-bit words of data into a wide accumulator,
+ *   padding a trailing odd byte with zero.  The generic checksum folds the
+ *   result into a 16-bit one's complement sum.
+ *
+ *   This function must be provided by architecture-specific logic if
+ *   CONFIG_LIBC_ARCH_CHKSUM is defined.
+ *
+ * Input Parameters:
+ *   data - Beginning of the data to sum, need not be aligned.
+ *   len  - Length of the data.
+ *
+ * Returned Value:
+ *   The sum of the 16-bit words.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_LIBC_ARCH_CHKSUM
+uint64_t up_chksum_words(FAR const void *data, size_t len);
+#endif
+
 /****************************************************************************
  * Name: net_chksum
  *
@@ -127,6 +127,12 @@ struct netdev_lowerhalf_s
   uint8_t rxtype;
   uint8_t priority;
 
+#ifdef CONFIG_NETDEV_RSS
+  /* Number of RX/TX queue pairs, used with receive_queue/transmit_queue */
+
+  uint8_t nqueues;
+#endif
+
   /* The structure used by net stack.
    * Note: Do not change its fields unless you know what you are doing.
    *
@@ -166,6 +172,22 @@ struct netdev_ops_s
 
   CODE FAR netpkt_t *(*receive)(FAR struct netdev_lowerhalf_s *dev);
 
+#ifdef CONFIG_NETDEV_RSS
+  /* transmit_queue/receive_queue - Same as transmit/receive, on the queue
+   *   pair qid (0 ~ nqueues - 1).  If provided, they are used instead of
+   *   transmit/receive, which may then be left NULL.  The upper half picks
+   *   the TX queue from the flow of the packet.  When a single queue is
+   *   polled, receive_queue is called without the device lock, so it must
+   *   only touch the state of queue qid; it is never called concurrently
+   *   for the same queue.
+   */
+
+  CODE int (*transmit_queue)(FAR struct netdev_lowerhalf_s *dev, int qid,
+                             FAR netpkt_t *pkt);
+  CODE FAR netpkt_t *(*receive_queue)(FAR struct netdev_lowerhalf_s *dev,
+                                      int qid);
+#endif
+
 #ifdef CONFIG_NET_MCASTGROUP
   CODE int (*addmac)(FAR struct netdev_lowerhalf_s *dev,
                      FAR const uint8_t *mac);
@@ -303,6 +325,25 @@ void netdev_lower_carrier_off(FAR struct netdev_lowerhalf_s *dev);
 
 void netdev_lower_rxready(FAR struct netdev_lowerhalf_s *dev);
 
+/****************************************************************************
+ * Name: netdev_lower_rxready_queue
+ *
+ * Description:
+ *   Notifies the networking layer about an RX packet is ready to read on
+ *   the RX queue qid.  In NETDEV_RX_THREAD_RSS mode only the thread of
+ *   that queue is woken up.
+ *
+ * Input Parameters:
+ *   dev - The lower half device driver structure
+ *   qid - The RX queue
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NETDEV_RSS
+void netdev_lower_rxready_queue(FAR struct netdev_lowerhalf_s *dev,
+                                int qid);
+#endif
+
 /****************************************************************************
  * Name: netdev_lower_txdone
  *
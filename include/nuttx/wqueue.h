@@ -591,6 +591,51 @@ void lpwork_boostpriority(uint8_t reqprio);
 void lpwork_restorepriority(uint8_t reqprio);
 #endif
 
+/****************************************************************************
+ * Name: work_boostpriority_wq
+ *
+ * Description:
+ *   Called by the work queue client to assure that the priority of the
+ *   worker threads of wqueue is at least at the requested level, reqprio.
+ *   This function would normally be called just before calling
+ *   work_queue_wq().
+ *
+ * Input Parameters:
+ *   wqueue  - The work queue handle
+ *   reqprio - Requested minimum worker thread priority
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_PRIORITY_INHERITANCE
+void work_boostpriority_wq(FAR struct kwork_wqueue_s *wqueue,
+                           uint8_t reqprio);
+#endif
+
+/****************************************************************************
+ * Name: work_restorepriority_wq
+ *
+ * Description:
+ *   This function is called to restore the priority of the worker threads
+ *   of wqueue after it was previously boosted by work_boostpriority_wq().
+ *
+ * Input Parameters:
+ *   wqueue  - The work queue handle
+ *   reqprio - Previously requested minimum worker thread priority to be
+ *     "unboosted"
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_PRIORITY_INHERITANCE
+void work_restorepriority_wq(FAR struct kwork_wqueue_s *wqueue,
+                             uint8_t reqprio);
+#endif
+
 /****************************************************************************
  * Name: work_notifier_setup
  *
@@ -0,0 +1,101 @@
+/****************************************************************************
+ * libs/libc/machine/arm64/arch_chksum.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <arm_neon.h>
+
+#include <nuttx/net/netdev.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Each 32-bit lane takes two 16-bit words per 16-byte vector, so it can
+ * not overflow within a block of this many vectors.
+ */
+
+#define CHKSUM_BLOCK 32768
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: up_chksum_words
+ *
+ * Description:
+ *   Sum the native 16-bit words of data with NEON.  The words are added
+ *   pairwise into 32-bit lanes (UADALP), which are widened into 64-bit
+ *   lanes once per block.
+ *
+ ****************************************************************************/
+
+uint64_t up_chksum_words(FAR const void *data, size_t len)
+{
+  FAR const uint8_t *ptr = data;
+  uint64x2_t acc64 = vdupq_n_u64(0);
+  uint32x4_t acc32;
+  size_t nvec = len / 16;
+  size_t n;
+  uint64_t acc;
+  uint16_t word;
+
+  while (nvec > 0)
+    {
+      n     = nvec < CHKSUM_BLOCK ? nvec : CHKSUM_BLOCK;
+      nvec -= n;
+      acc32 = vdupq_n_u32(0);
+
+      while (n-- > 0)
+        {
+          acc32 = vpadalq_u16(acc32,
+                              vreinterpretq_u16_u8(vld1q_u8(ptr)));
+          ptr  += 16;
+        }
+
+      acc64 = vpadalq_u32(acc64, acc32);
+    }
+
+  acc = vgetq_lane_u64(acc64, 0) + vgetq_lane_u64(acc64, 1);
+
+  for (len &= 15; len >= 2; ptr += 2, len -= 2)
+    {
+      memcpy(&word, ptr, sizeof(word));
+      acc += word;
+    }
+
+  /* A trailing odd byte is the low byte of a little-endian word */
+
+  if (len > 0)
+    {
+      acc += *ptr;
+    }
+
+  return acc;
+}
@@ -0,0 +1,149 @@
+/****************************************************************************
+ * libs/libc/machine/x86_64/arch_chksum.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <immintrin.h>
+
+#include <nuttx/net/netdev.h>
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: chksum_sse2
+ *
+ * Description:
+ *   Sum the native 16-bit words of nvec 16-byte vectors.  The low and the
+ *   high bytes of the words are summed separately with PSADBW into 64-bit
+ *   lanes, so nothing can overflow.
+ *
+ ****************************************************************************/
+
+static uint64_t chksum_sse2(FAR const uint8_t *data, size_t nvec)
+{
+  const __m128i mask = _mm_set1_epi16(0x00ff);
+  const __m128i zero = _mm_setzero_si128();
+  __m128i lo = zero;
+  __m128i hi = zero;
+  __m128i v;
+
+  while (nvec-- > 0)
+    {
+      v     = _mm_loadu_si128((FAR const __m128i *)data);
+      lo    = _mm_add_epi64(lo, _mm_sad_epu8(_mm_and_si128(v, mask), zero));
+      hi    = _mm_add_epi64(hi, _mm_sad_epu8(_mm_srli_epi16(v, 8), zero));
+      data += 16;
+    }
+
+  lo = _mm_add_epi64(lo, _mm_slli_epi64(hi, 8));
+  lo = _mm_add_epi64(lo, _mm_unpackhi_epi64(lo, lo));
+  return (uint64_t)_mm_cvtsi128_si64(lo);
+}
+
+/****************************************************************************
+ * Name: chksum_avx2
+ *
+ * Description:
+ *   Same as chksum_sse2(), on nvec 32-byte vectors.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_ARCH_X86_64_AVX
+__attribute__((target("avx2")))
+static uint64_t chksum_avx2(FAR const uint8_t *data, size_t nvec)
+{
+  const __m256i mask = _mm256_set1_epi16(0x00ff);
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i lo = zero;
+  __m256i hi = zero;
+  __m256i v;
+  __m128i sum;
+
+  while (nvec-- > 0)
+    {
+      v     = _mm256_loadu_si256((FAR const __m256i *)data);
+      lo    = _mm256_add_epi64(lo,
+                _mm256_sad_epu8(_mm256_and_si256(v, mask), zero));
+      hi    = _mm256_add_epi64(hi,
+                _mm256_sad_epu8(_mm256_srli_epi16(v, 8), zero));
+      data += 32;
+    }
+
+  lo  = _mm256_add_epi64(lo, _mm256_slli_epi64(hi, 8));
+  sum = _mm_add_epi64(_mm256_castsi256_si128(lo),
+                      _mm256_extracti128_si256(lo, 1));
+  sum = _mm_add_epi64(sum, _mm_unpackhi_epi64(sum, sum));
+  return (uint64_t)_mm_cvtsi128_si64(sum);
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: up_chksum_words
+ *
+ * Description:
+ *   Sum the native 16-bit words of data with SSE2, or AVX2 if enabled.
+ *
+ ****************************************************************************/
+
+uint64_t up_chksum_words(FAR const void *data, size_t len)
+{
+  FAR const uint8_t *ptr = data;
+  uint64_t acc = 0;
+  uint16_t word;
+
+#ifdef CONFIG_ARCH_X86_64_AVX
+  acc += chksum_avx2(ptr, len / 32);
+  ptr += len & ~(size_t)31;
+  len &= 31;
+#endif
+
+  acc += chksum_sse2(ptr, len / 16);
+  ptr += len & ~(size_t)15;
+  len &= 15;
+
+  for (; len >= 2; ptr += 2, len -= 2)
+    {
+      memcpy(&word, ptr, sizeof(word));
+      acc += word;
+    }
+
+  /* A trailing odd byte is the low byte of a little-endian word */
+
+  if (len > 0)
+    {
+      acc += *ptr;
+    }
+
+  return acc;
+}
@@ -98,6 +98,16 @@ extern int16_t g_qentry_wait;
 
 extern volatile spinlock_t g_iob_lock;
 
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+/* A list of all free, unallocated large I/O buffers */
+
+extern FAR struct iob_s *g_iob_largefreelist;
+
+/* Counts free large I/O buffers */
+
+extern int16_t g_iob_largecount;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -137,6 +147,20 @@ FAR struct iob_qentry_s *iob_tryalloc_qentry(void);
 
 FAR struct iob_qentry_s *iob_free_qentry(FAR struct iob_qentry_s *iobq);
 
+/****************************************************************************
+ * Name: iob_free_large
+ *
+ * Description:
+ *   The io_free callback of the large I/O buffers: Return the large I/O
+ *   buffer to the free list of its size class.  This function is intended
+ *   only for internal use by the IOB module.
+ *
+ ****************************************************************************/
+
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+void iob_free_large(FAR void *data);
+#endif
+
 /****************************************************************************
  * Name: iob_notifier_signal
  *
@@ -221,6 +221,44 @@ static FAR struct iob_s *iob_allocwait(bool throttled, unsigned int timeout)
   return iob;
 }
 
+/****************************************************************************
+ * Name: iob_tryalloc_large
+ *
+ * Description:
+ *   Try to allocate an I/O buffer of the large size class.  Large I/O
+ *   buffers are never waited for.
+ *
+ ****************************************************************************/
+
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+static FAR struct iob_s *iob_tryalloc_large(void)
+{
+  FAR struct iob_s *iob;
+  irqstate_t flags;
+
+  flags = spin_lock_irqsave(&g_iob_lock);
+
+  iob = g_iob_largefreelist;
+  if (iob != NULL)
+    {
+      g_iob_largefreelist = iob->io_flink;
+
+      g_iob_largecount--;
+      DEBUGASSERT(g_iob_largecount >= 0);
+
+      /* Put the I/O buffer in a known state */
+
+      iob->io_flink  = NULL; /* Not in a chain */
+      iob->io_len    = 0;    /* Length of the data in the entry */
+      iob->io_offset = 0;    /* Offset to the beginning of data */
+      iob->io_pktlen = 0;    /* Total length of the packet */
+    }
+
+  spin_unlock_irqrestore(&g_iob_lock, flags);
+  return iob;
+}
+#endif
+
 #ifdef CONFIG_IOB_ALLOC
 /****************************************************************************
  * Name: iob_free_dynamic
@@ -311,6 +349,60 @@ FAR struct iob_s *iob_tryalloc(bool throttled)
   return iob;
 }
 
+/****************************************************************************
+ * Name: iob_alloc_len
+ *
+ * Description:
+ *   Allocate the I/O buffer of the best size class for 'len' bytes of
+ *   payload, waiting if necessary.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *iob_alloc_len(bool throttled, unsigned int len)
+{
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+  FAR struct iob_s *iob;
+
+  if (len > CONFIG_IOB_BUFSIZE)
+    {
+      iob = iob_tryalloc_large();
+      if (iob != NULL)
+        {
+          return iob;
+        }
+    }
+#endif
+
+  return iob_alloc(throttled);
+}
+
+/****************************************************************************
+ * Name: iob_tryalloc_len
+ *
+ * Description:
+ *   Try to allocate the I/O buffer of the best size class for 'len' bytes
+ *   of payload without waiting for a buffer to become free.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *iob_tryalloc_len(bool throttled, unsigned int len)
+{
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+  FAR struct iob_s *iob;
+
+  if (len > CONFIG_IOB_BUFSIZE)
+    {
+      iob = iob_tryalloc_large();
+      if (iob != NULL)
+        {
+          return iob;
+        }
+    }
+#endif
+
+  return iob_tryalloc(throttled);
+}
+
 #ifdef CONFIG_IOB_ALLOC
 
 /****************************************************************************
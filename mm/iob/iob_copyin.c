@@ -185,11 +185,11 @@ static int iob_copyin_internal(FAR struct iob_s *iob, FAR const uint8_t *src,
 
           if (can_block)
             {
-              next = iob_alloc(throttled);
+              next = iob_alloc_len(throttled, len);
             }
           else
             {
-              next = iob_tryalloc(throttled);
+              next = iob_tryalloc_len(throttled, len);
             }
 
           if (next == NULL)
@@ -68,6 +68,32 @@
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: iob_free_large
+ *
+ * Description:
+ *   The io_free callback of the large I/O buffers: Return the large I/O
+ *   buffer to the free list of its size class.
+ *
+ ****************************************************************************/
+
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+void iob_free_large(FAR void *data)
+{
+  FAR struct iob_s *iob = data;
+  irqstate_t flags;
+
+  flags = spin_lock_irqsave(&g_iob_lock);
+
+  iob->io_flink       = g_iob_largefreelist;
+  g_iob_largefreelist = iob;
+  g_iob_largecount++;
+  DEBUGASSERT(g_iob_largecount <= CONFIG_IOB_LARGE_NBUFFERS);
+
+  spin_unlock_irqrestore(&g_iob_lock, flags);
+}
+#endif
+
 /****************************************************************************
  * Name: iob_free
  *
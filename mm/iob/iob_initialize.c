@@ -49,6 +49,20 @@
 #define IOB_BUFFER_SIZE   (IOB_ALIGN_SIZE * CONFIG_IOB_NBUFFERS + \
                            IOB_ALIGNMENT - 1)
 
+/* The payload of a large I/O buffer directly follows the aligned header,
+ * where iob_free() expects a buffer that it hands back to io_free().
+ */
+
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+#  define IOB_LARGE_HDR_SIZE    ALIGN_UP(sizeof(struct iob_s), IOB_ALIGNMENT)
+#  define IOB_LARGE_ALIGN_SIZE  (IOB_LARGE_HDR_SIZE + \
+                                 ALIGN_UP(CONFIG_IOB_LARGE_BUFSIZE, \
+                                          IOB_ALIGNMENT))
+#  define IOB_LARGE_BUFFER_SIZE (IOB_LARGE_ALIGN_SIZE * \
+                                 CONFIG_IOB_LARGE_NBUFFERS + \
+                                 IOB_ALIGNMENT - 1)
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -64,6 +78,15 @@ static uint8_t g_iob_buffer[IOB_BUFFER_SIZE] locate_data(IOB_SECTION);
 static uint8_t g_iob_buffer[IOB_BUFFER_SIZE];
 #endif
 
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+#  ifdef IOB_SECTION
+static uint8_t g_iob_largebuffer[IOB_LARGE_BUFFER_SIZE]
+                                locate_data(IOB_SECTION);
+#  else
+static uint8_t g_iob_largebuffer[IOB_LARGE_BUFFER_SIZE];
+#  endif
+#endif
+
 #if CONFIG_IOB_NCHAINS > 0
 /* This is a pool of pre-allocated iob_qentry_s buffers */
 
@@ -117,6 +140,16 @@ int16_t g_qentry_wait = 0;
 
 volatile spinlock_t g_iob_lock = SP_UNLOCKED;
 
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+/* A list of all free, unallocated large I/O buffers */
+
+FAR struct iob_s *g_iob_largefreelist;
+
+/* Counts free large I/O buffers */
+
+int16_t g_iob_largecount = CONFIG_IOB_LARGE_NBUFFERS;
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -159,6 +192,24 @@ void iob_initialize(void)
       g_iob_freelist  = iob;
     }
 
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+  /* Add each large I/O buffer to the free list of its size class */
+
+  buf = ALIGN_UP((uintptr_t)g_iob_largebuffer, IOB_ALIGNMENT);
+
+  for (i = 0; i < CONFIG_IOB_LARGE_NBUFFERS; i++)
+    {
+      FAR struct iob_s *iob =
+        (FAR struct iob_s *)(buf + i * IOB_LARGE_ALIGN_SIZE);
+
+      iob->io_flink       = g_iob_largefreelist;
+      iob->io_bufsize     = CONFIG_IOB_LARGE_BUFSIZE;
+      iob->io_free        = iob_free_large;
+      iob->io_data        = (FAR uint8_t *)iob + IOB_LARGE_HDR_SIZE;
+      g_iob_largefreelist = iob;
+    }
+#endif
+
 #if CONFIG_IOB_NCHAINS > 0
   /* Add each I/O buffer chain queue container to the free list */
 
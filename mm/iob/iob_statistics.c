@@ -74,6 +74,12 @@ void iob_getstats(FAR struct iob_stats_s *stats)
     {
       stats->nthrottle = 0;
     }
+
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+  stats->nlargesize  = CONFIG_IOB_LARGE_BUFSIZE;
+  stats->nlargetotal = CONFIG_IOB_LARGE_NBUFFERS;
+  stats->nlargefree  = g_iob_largecount;
+#endif
 }
 
 #endif /* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS &&
@@ -27,9 +27,11 @@
 #include <assert.h>
 #include <execinfo.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <syslog.h>
 
+#include <nuttx/irq.h>
 #include <nuttx/kmalloc.h>
 #include <nuttx/mm/kasan.h>
 #include <nuttx/mm/mempool.h>
@@ -100,6 +102,89 @@ static inline void mempool_add_queue(FAR struct mempool_s *pool,
     }
 }
 
+static inline void mempool_free_check(FAR struct mempool_s *pool,
+                                      FAR void *blk)
+{
+#if CONFIG_MM_BACKTRACE >= 0
+  FAR struct mempool_backtrace_s *buf =
+    (FAR struct mempool_backtrace_s *)((FAR char *)blk + pool->blocksize);
+
+  /* Check double free or out of out of bounds */
+
+  DEBUGASSERT(buf->magic == MEMPOOL_MAGIC_ALLOC);
+  buf->magic = MEMPOOL_MAGIC_FREE;
+#endif
+
+#ifdef CONFIG_MM_FILL_ALLOCATIONS
+  memset(blk, MM_FREE_MAGIC, pool->blocksize);
+#endif
+}
+
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+/* Only the expandable pools are cached per CPU: a block parked in the
+ * cache of another CPU must never be the reason why an allocation fails
+ * or a waiter is not woken up.
+ */
+
+static inline bool mempool_cpucache_enabled(FAR struct mempool_s *pool,
+                                            FAR void *blk)
+{
+  return pool->expandsize > 0 &&
+         (pool->ibase == NULL || (FAR char *)blk < pool->ibase ||
+          (FAR char *)blk >= pool->ibase + pool->interruptsize);
+}
+
+static size_t mempool_cpucache_count(FAR struct mempool_s *pool)
+{
+  size_t count = 0;
+  int cpu;
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      count += pool->cache[cpu].count;
+    }
+
+  return count;
+}
+
+/* Move up to nblks free blocks from the pool to the cache, the pool lock
+ * must be held.
+ */
+
+static void mempool_cpucache_fill(FAR struct mempool_s *pool,
+                                  FAR struct mempool_cpucache_s *cache,
+                                  size_t nblks)
+{
+  FAR sq_entry_t *blk;
+
+  while (nblks-- > 0 &&
+         (blk = mempool_remove_queue(pool, &pool->queue)) != NULL)
+    {
+      sq_addlast(blk, &cache->queue);
+      cache->count++;
+      pool->nalloc++;
+    }
+}
+
+/* Move up to nblks free blocks from the cache back to the pool, the pool
+ * lock must be held.
+ */
+
+static void mempool_cpucache_drain(FAR struct mempool_s *pool,
+                                   FAR struct mempool_cpucache_s *cache,
+                                   size_t nblks)
+{
+  FAR sq_entry_t *blk;
+
+  while (nblks-- > 0 && (blk = sq_remfirst(&cache->queue)) != NULL)
+    {
+      sq_addlast(blk, &pool->queue);
+      cache->count--;
+      pool->nalloc--;
+    }
+}
+#endif
+
 #if CONFIG_MM_BACKTRACE >= 0
 static inline void mempool_add_backtrace(FAR struct mempool_s *pool,
                                          FAR struct mempool_backtrace_s *buf)
@@ -264,11 +349,22 @@ mempool_memdump_free_callback(FAR struct mempool_s *pool,
 int mempool_init(FAR struct mempool_s *pool, FAR const char *name)
 {
   size_t blocksize = MEMPOOL_REALBLOCKSIZE(pool);
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+  int cpu;
+#endif
 
   sq_init(&pool->queue);
   sq_init(&pool->iqueue);
   sq_init(&pool->equeue);
   pool->nalloc = 0;
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      sq_init(&pool->cache[cpu].queue);
+      pool->cache[cpu].count = 0;
+    }
+#endif
+
   if (pool->interruptsize >= blocksize)
     {
       size_t ninterrupt = pool->interruptsize / blocksize;
@@ -354,6 +450,24 @@ FAR void *mempool_allocate(FAR struct mempool_s *pool)
   FAR sq_entry_t *blk;
   irqstate_t flags;
 
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+  FAR struct mempool_cpucache_s *cache;
+
+  /* Try the cache of this CPU first, it doesn't need the pool lock */
+
+  flags = up_irq_save();
+  cache = &pool->cache[this_cpu()];
+  blk = sq_remfirst(&cache->queue);
+  if (blk != NULL)
+    {
+      cache->count--;
+      up_irq_restore(flags);
+      goto out;
+    }
+
+  up_irq_restore(flags);
+#endif
+
 retry:
   flags = spin_lock_irqsave(&pool->lock);
   blk = mempool_remove_queue(pool, &pool->queue);
@@ -407,8 +521,22 @@ retry:
     }
 
   pool->nalloc++;
+
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+  /* Refill the cache of this CPU while we are holding the pool lock */
+
+  if (mempool_cpucache_enabled(pool, blk))
+    {
+      mempool_cpucache_fill(pool, &pool->cache[this_cpu()],
+                            CONFIG_MM_MEMPOOL_CPUCACHE / 2);
+    }
+#endif
+
   spin_unlock_irqrestore(&pool->lock, flags);
 
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+out:
+#endif
 #if CONFIG_MM_BACKTRACE >= 0
   mempool_add_backtrace(pool, (FAR struct mempool_backtrace_s *)
                               ((FAR char *)blk + pool->blocksize));
@@ -435,22 +563,43 @@ retry:
 
 void mempool_release(FAR struct mempool_s *pool, FAR void *blk)
 {
-  irqstate_t flags = spin_lock_irqsave(&pool->lock);
-#if CONFIG_MM_BACKTRACE >= 0
-  FAR struct mempool_backtrace_s *buf =
-    (FAR struct mempool_backtrace_s *)((FAR char *)blk + pool->blocksize);
+  irqstate_t flags;
 
-  /* Check double free or out of out of bounds */
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+  FAR struct mempool_cpucache_s *cache;
 
-  DEBUGASSERT(buf->magic == MEMPOOL_MAGIC_ALLOC);
-  buf->magic = MEMPOOL_MAGIC_FREE;
+  /* Park the block in the cache of this CPU if there is room */
+
+  if (mempool_cpucache_enabled(pool, blk))
+    {
+      flags = up_irq_save();
+      cache = &pool->cache[this_cpu()];
+      if (cache->count < CONFIG_MM_MEMPOOL_CPUCACHE)
+        {
+          mempool_free_check(pool, blk);
+          sq_addfirst(blk, &cache->queue);
+          cache->count++;
+          kasan_poison(blk, pool->blocksize);
+          up_irq_restore(flags);
+          return;
+        }
 
+      up_irq_restore(flags);
+    }
 #endif
 
+  flags = spin_lock_irqsave(&pool->lock);
+  mempool_free_check(pool, blk);
   pool->nalloc--;
 
-#ifdef CONFIG_MM_FILL_ALLOCATIONS
-  memset(blk, MM_FREE_MAGIC, pool->blocksize);
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+  /* The cache of this CPU is full, give half of it back to the pool */
+
+  cache = &pool->cache[this_cpu()];
+  if (cache->count >= CONFIG_MM_MEMPOOL_CPUCACHE)
+    {
+      mempool_cpucache_drain(pool, cache, CONFIG_MM_MEMPOOL_CPUCACHE / 2);
+    }
 #endif
 
   if (pool->ibase)
@@ -502,6 +651,9 @@ int mempool_info(FAR struct mempool_s *pool, FAR struct mempoolinfo_s *info)
 {
   size_t blocksize = MEMPOOL_REALBLOCKSIZE(pool);
   irqstate_t flags;
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+  size_t cached;
+#endif
 
   DEBUGASSERT(pool != NULL && info != NULL);
 
@@ -509,6 +661,11 @@ int mempool_info(FAR struct mempool_s *pool, FAR struct mempoolinfo_s *info)
   info->ordblks = sq_count(&pool->queue);
   info->iordblks = sq_count(&pool->iqueue);
   info->aordblks = pool->nalloc;
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+  cached = mempool_cpucache_count(pool);
+  info->ordblks += cached;
+  info->aordblks -= cached;
+#endif
   info->arena = sq_count(&pool->equeue) * MEMPOOL_HEADER_SIZE +
     (info->aordblks + info->ordblks + info->iordblks) * blocksize;
   spin_unlock_irqrestore(&pool->lock, flags);
@@ -548,14 +705,22 @@ mempool_info_task(FAR struct mempool_s *pool,
       size_t count = sq_count(&pool->queue) +
                      sq_count(&pool->iqueue);
 
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+      count += mempool_cpucache_count(pool);
+#endif
       spin_unlock_irqrestore(&pool->lock, flags);
       info.aordblks += count;
       info.uordblks += count * blocksize;
     }
   else if (task->pid == PID_MM_ALLOC)
     {
-      info.aordblks += pool->nalloc;
-      info.uordblks += pool->nalloc * blocksize;
+      size_t nalloc = pool->nalloc;
+
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+      nalloc -= mempool_cpucache_count(pool);
+#endif
+      info.aordblks += nalloc;
+      info.uordblks += nalloc * blocksize;
     }
 #if CONFIG_MM_BACKTRACE >= 0
   else
@@ -624,6 +789,16 @@ int mempool_deinit(FAR struct mempool_s *pool)
   size_t blocksize = MEMPOOL_REALBLOCKSIZE(pool);
   FAR sq_entry_t *blk;
   size_t count = 0;
+#if CONFIG_MM_MEMPOOL_CPUCACHE > 0
+  int cpu;
+
+  /* Return the cached blocks to the pool before checking for users */
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      mempool_cpucache_drain(pool, &pool->cache[cpu], SIZE_MAX);
+    }
+#endif
 
   if (pool->nalloc != 0)
     {
@@ -32,6 +32,7 @@
 #include <errno.h>
 
 #include <nuttx/fs/fs.h>
+#include <nuttx/fs/ioctl.h>
 #include <nuttx/mm/iob.h>
 #include <nuttx/net/netdev.h>
 
@@ -51,6 +52,11 @@
  *   This is identical to calling devif_file_send() except that the data is
  *   in a available file handle.
  *
+ *   If the file system reports the memory holding the data
+ *   (FIOC_GETEXTENT), the data is copied from there into the IOB without
+ *   a read() and the extent is released again (FIOC_PUTEXTENT).  The file
+ *   is only read for whatever part it does not report.
+ *
  * Assumptions:
  *   Called with the network locked.
  *
@@ -96,14 +102,39 @@ int devif_file_send(FAR struct net_driver_s *dev, FAR struct file *file,
 
   iob_update_pktlen(dev->d_iob, target_offset, false);
 
-  ret = file_seek(file, offset, SEEK_SET);
-  if (ret < 0)
+  remain = len;
+  while (remain > 0)
     {
-      goto errout;
+      struct file_extent_s ext;
+
+      ext.fe_offset = offset + len - remain;
+      ext.fe_length = remain;
+      if (file_ioctl(file, FIOC_GETEXTENT, &ext) < 0 || ext.fe_length == 0)
+        {
+          break;
+        }
+
+      ret = iob_trycopyin(dev->d_iob, ext.fe_base, ext.fe_length,
+                          target_offset + len - remain, false);
+      file_ioctl(file, FIOC_PUTEXTENT, &ext);
+      if (ret < 0)
+        {
+          goto errout;
+        }
+
+      remain -= ext.fe_length;
+    }
+
+  if (remain > 0)
+    {
+      ret = file_seek(file, offset + len - remain, SEEK_SET);
+      if (ret < 0)
+        {
+          goto errout;
+        }
     }
 
   iob = dev->d_iob;
-  remain = len;
 
   while (remain > 0)
     {
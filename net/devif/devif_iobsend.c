@@ -74,7 +74,11 @@ int devif_iob_send(FAR struct net_driver_s *dev, FAR struct iob_s *iob,
     }
 
 #ifndef CONFIG_NET_IPFRAG
-  if (len > NETDEV_PKTSIZE(dev) - NET_LL_HDRLEN(dev) - target_offset)
+  if (len > NETDEV_PKTSIZE(dev) - NET_LL_HDRLEN(dev) - target_offset
+#  ifdef CONFIG_NETDEV_TSO
+      && (dev->d_features & NETDEV_TX_TSO) == 0
+#  endif
+     )
     {
       ret = -EMSGSIZE;
       goto errout;
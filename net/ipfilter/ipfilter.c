@@ -37,6 +37,7 @@
 #include "icmp/icmp.h"
 #include "icmpv6/icmpv6.h"
 #include "ipfilter/ipfilter.h"
+#include "ipforward/ipforward.h"
 #include "utils/utils.h"
 
 #ifdef CONFIG_NET_IPFILTER
@@ -420,6 +421,8 @@ void ipfilter_cfg_add(FAR struct ipfilter_entry_s *entry,
       sq_addlast((FAR sq_entry_t *)entry, &g_ipv6_filters[chain]);
     }
 #endif
+
+  ipfwd_flow_flush();
 }
 
 /****************************************************************************
@@ -461,6 +464,8 @@ void ipfilter_cfg_clear(sa_family_t family, enum ipfilter_chain_e chain)
         }
     }
 #endif
+
+  ipfwd_flow_flush();
 }
 
 /****************************************************************************
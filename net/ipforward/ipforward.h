@@ -32,6 +32,8 @@
 #include <assert.h>
 #include <stdint.h>
 
+#include <nuttx/net/ip.h>
+
 #undef HAVE_FWDALLOC
 #ifdef CONFIG_NET_IPFORWARD
 
@@ -76,6 +78,39 @@ struct forward_s
 #endif
 };
 
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+/* The key of a forwarded flow.  The members up to fk_gen are compared as a
+ * whole, so a key must be zeroed before it is filled in.
+ */
+
+struct ipfwd_flowkey_s
+{
+  FAR struct net_driver_s *fk_dev;        /* Receiving device */
+  union
+  {
+#ifdef CONFIG_NET_IPv4
+    in_addr_t                  ipv4[2];
+#endif
+#ifdef CONFIG_NET_IPv6
+    net_ipv6addr_t             ipv6[2];
+#endif
+  } fk_addr;                              /* Source and destination */
+  uint8_t                      fk_l4[4];  /* Ports or ICMP type and code */
+  uint8_t                      fk_proto;  /* L4 protocol */
+  uint8_t                      fk_domain; /* PF_INET, PF_INET6 or 0 */
+  unsigned int                 fk_gen;    /* Cache generation of the key */
+  uint32_t                     fk_hash;   /* Hash of the key */
+};
+
+/* A cached forwarding decision */
+
+struct ipfwd_flow_s
+{
+  struct ipfwd_flowkey_s       fl_key;    /* Flow key */
+  FAR struct net_driver_s     *fl_dev;    /* Forwarding device */
+};
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -355,5 +390,81 @@ void ipv4_dropstats(FAR struct ipv4_hdr_s *ipv4);
 #  define ipv4_dropstats(ipv4)
 #endif
 
+/****************************************************************************
+ * Name: ipv4_flow_lookup and ipv6_flow_lookup
+ *
+ * Description:
+ *   Look up the flow of a packet to be forwarded in the flow cache.  Once
+ *   the first packet of a flow has been routed and accepted by the FORWARD
+ *   filter chain, the following packets of the flow can skip both.
+ *
+ * Input Parameters:
+ *   dev       - The device on which the packet was received
+ *   ipv4/ipv6 - The IPv4/IPv6 header of the packet
+ *   key       - Returns the key of the flow, to be passed to
+ *               ipfwd_flow_add() on a miss
+ *
+ * Returned Value:
+ *   The forwarding device of the flow; NULL if the flow is not cached.
+ *
+ * Assumptions:
+ *   The receiving device is locked.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_NET_IPFORWARD_FLOWCACHE) && defined(CONFIG_NET_IPv4)
+FAR struct net_driver_s *
+ipv4_flow_lookup(FAR struct net_driver_s *dev, FAR struct ipv4_hdr_s *ipv4,
+                 FAR struct ipfwd_flowkey_s *key);
+#endif
+
+#if defined(CONFIG_NET_IPFORWARD_FLOWCACHE) && defined(CONFIG_NET_IPv6)
+FAR struct net_driver_s *
+ipv6_flow_lookup(FAR struct net_driver_s *dev, FAR struct ipv6_hdr_s *ipv6,
+                 FAR struct ipfwd_flowkey_s *key);
+#endif
+
+/****************************************************************************
+ * Name: ipfwd_flow_add
+ *
+ * Description:
+ *   Cache the forwarding device of a flow after its packet has been
+ *   accepted for forwarding.  Nothing is cached if the flow can not be
+ *   cached or if the cache was flushed since the key was made.
+ *
+ * Input Parameters:
+ *   key    - The key returned by ipv4_flow_lookup() or ipv6_flow_lookup()
+ *   fwddev - The forwarding device
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+void ipfwd_flow_add(FAR const struct ipfwd_flowkey_s *key,
+                    FAR struct net_driver_s *fwddev);
+#endif
+
 #endif /* CONFIG_NET_IPFORWARD */
+
+/****************************************************************************
+ * Name: ipfwd_flow_flush
+ *
+ * Description:
+ *   Invalidate all flows in the flow cache.  This must be called whenever
+ *   something that the forwarding decision depends on changes: routes,
+ *   filter rules, device addresses and the device state.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+void ipfwd_flow_flush(void);
+#else
+#  define ipfwd_flow_flush()
+#endif
+
 #endif /* __NET_IPFORWARD_IPFORWARD_H */
@@ -0,0 +1,284 @@
+/****************************************************************************
+ * net/ipforward/ipfwd_flow.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nuttx/spinlock.h>
+#include <nuttx/net/ip.h>
+#include <nuttx/net/ipv6ext.h>
+#include <nuttx/net/netdev.h>
+
+#include "ipforward/ipforward.h"
+
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The part of the key that identifies a flow */
+
+#define FLOWKEY_CMPLEN offsetof(struct ipfwd_flowkey_s, fk_gen)
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The flow cache is direct mapped: a flow replaces the one that was in its
+ * slot.  A flush only bumps the generation, entries of an older generation
+ * never match.
+ */
+
+static struct ipfwd_flow_s g_flows[CONFIG_NET_IPFORWARD_FLOWCACHE_SIZE];
+static unsigned int g_flowgen;
+static spinlock_t g_flowlock = SP_UNLOCKED;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: ipfwd_flow_l4
+ *
+ * Description:
+ *   Add the part of the L4 header that the filter rules can match to the
+ *   key: the ports of TCP and UDP, the type and code of ICMP.
+ *
+ ****************************************************************************/
+
+static void ipfwd_flow_l4(FAR struct ipfwd_flowkey_s *key,
+                          FAR const uint8_t *l4hdr)
+{
+  switch (key->fk_proto)
+    {
+      case IP_PROTO_TCP:
+      case IP_PROTO_UDP:
+      case IP_PROTO_ICMP:
+      case IP_PROTO_ICMP6:
+        memcpy(key->fk_l4, l4hdr, sizeof(key->fk_l4));
+        break;
+
+      default:
+        break;
+    }
+}
+
+/****************************************************************************
+ * Name: ipfwd_flow_find
+ *
+ * Description:
+ *   Complete the key and look it up in the cache.
+ *
+ ****************************************************************************/
+
+static FAR struct net_driver_s *
+ipfwd_flow_find(FAR struct ipfwd_flowkey_s *key, unsigned int naddrwords)
+{
+  FAR const uint32_t *words = (FAR const uint32_t *)&key->fk_addr;
+  FAR struct net_driver_s *fwddev = NULL;
+  FAR struct ipfwd_flow_s *flow;
+  irqstate_t flags;
+  uint32_t hash;
+  uint32_t l4;
+  unsigned int i;
+
+  memcpy(&l4, key->fk_l4, sizeof(l4));
+  hash = (uint32_t)(uintptr_t)key->fk_dev ^ key->fk_proto;
+  for (i = 0; i < naddrwords; i++)
+    {
+      hash = (hash ^ words[i]) * 0x9e3779b1;
+    }
+
+  hash = (hash ^ l4) * 0x9e3779b1;
+  key->fk_hash = hash ^ (hash >> 16);
+
+  flow  = &g_flows[key->fk_hash % CONFIG_NET_IPFORWARD_FLOWCACHE_SIZE];
+  flags = spin_lock_irqsave(&g_flowlock);
+
+  key->fk_gen = g_flowgen;
+  if (flow->fl_key.fk_gen == key->fk_gen &&
+      memcmp(&flow->fl_key, key, FLOWKEY_CMPLEN) == 0)
+    {
+      fwddev = flow->fl_dev;
+    }
+
+  spin_unlock_irqrestore(&g_flowlock, flags);
+  return fwddev;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: ipv4_flow_lookup and ipv6_flow_lookup
+ *
+ * Description:
+ *   Look up the flow of a packet to be forwarded in the flow cache.  Once
+ *   the first packet of a flow has been routed and accepted by the FORWARD
+ *   filter chain, the following packets of the flow can skip both.
+ *
+ * Input Parameters:
+ *   dev       - The device on which the packet was received
+ *   ipv4/ipv6 - The IPv4/IPv6 header of the packet
+ *   key       - Returns the key of the flow, to be passed to
+ *               ipfwd_flow_add() on a miss
+ *
+ * Returned Value:
+ *   The forwarding device of the flow; NULL if the flow is not cached.
+ *
+ * Assumptions:
+ *   The receiving device is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPv4
+FAR struct net_driver_s *
+ipv4_flow_lookup(FAR struct net_driver_s *dev, FAR struct ipv4_hdr_s *ipv4,
+                 FAR struct ipfwd_flowkey_s *key)
+{
+  uint16_t iphdrlen = (ipv4->vhl & IPv4_HLMASK) << 2;
+
+  memset(key, 0, sizeof(*key));
+
+  /* Fragments do not all carry the L4 header, leave them to the slow
+   * path.
+   */
+
+  if ((ipv4->ipoffset[0] & 0x3f) != 0 || ipv4->ipoffset[1] != 0 ||
+      dev->d_len < iphdrlen + sizeof(key->fk_l4))
+    {
+      return NULL;
+    }
+
+  key->fk_dev    = dev;
+  key->fk_proto  = ipv4->proto;
+  key->fk_domain = PF_INET;
+  net_ipv4addr_copy(key->fk_addr.ipv4[0],
+                    net_ip4addr_conv32(ipv4->srcipaddr));
+  net_ipv4addr_copy(key->fk_addr.ipv4[1],
+                    net_ip4addr_conv32(ipv4->destipaddr));
+  ipfwd_flow_l4(key, (FAR const uint8_t *)ipv4 + iphdrlen);
+
+  return ipfwd_flow_find(key, 2);
+}
+#endif
+
+#ifdef CONFIG_NET_IPv6
+FAR struct net_driver_s *
+ipv6_flow_lookup(FAR struct net_driver_s *dev, FAR struct ipv6_hdr_s *ipv6,
+                 FAR struct ipfwd_flowkey_s *key)
+{
+  memset(key, 0, sizeof(*key));
+
+  /* Packets with extension headers, fragments among them, take the slow
+   * path.
+   */
+
+  if (ipv6_exthdr(ipv6->proto) ||
+      dev->d_len < IPv6_HDRLEN + sizeof(key->fk_l4))
+    {
+      return NULL;
+    }
+
+  key->fk_dev    = dev;
+  key->fk_proto  = ipv6->proto;
+  key->fk_domain = PF_INET6;
+  net_ipv6addr_copy(key->fk_addr.ipv6[0], ipv6->srcipaddr);
+  net_ipv6addr_copy(key->fk_addr.ipv6[1], ipv6->destipaddr);
+  ipfwd_flow_l4(key, (FAR const uint8_t *)ipv6 + IPv6_HDRLEN);
+
+  return ipfwd_flow_find(key, 8);
+}
+#endif
+
+/****************************************************************************
+ * Name: ipfwd_flow_add
+ *
+ * Description:
+ *   Cache the forwarding device of a flow after its packet has been
+ *   accepted for forwarding.  Nothing is cached if the flow can not be
+ *   cached or if the cache was flushed since the key was made.
+ *
+ * Input Parameters:
+ *   key    - The key returned by ipv4_flow_lookup() or ipv6_flow_lookup()
+ *   fwddev - The forwarding device
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void ipfwd_flow_add(FAR const struct ipfwd_flowkey_s *key,
+                    FAR struct net_driver_s *fwddev)
+{
+  FAR struct ipfwd_flow_s *flow;
+  irqstate_t flags;
+
+  if (key->fk_domain == 0)
+    {
+      return;
+    }
+
+  flow  = &g_flows[key->fk_hash % CONFIG_NET_IPFORWARD_FLOWCACHE_SIZE];
+  flags = spin_lock_irqsave(&g_flowlock);
+
+  /* A route or rule may have changed while the packet took the slow path */
+
+  if (key->fk_gen == g_flowgen)
+    {
+      memcpy(&flow->fl_key, key, sizeof(*key));
+      flow->fl_dev = fwddev;
+    }
+
+  spin_unlock_irqrestore(&g_flowlock, flags);
+}
+
+/****************************************************************************
+ * Name: ipfwd_flow_flush
+ *
+ * Description:
+ *   Invalidate all flows in the flow cache.  This must be called whenever
+ *   something that the forwarding decision depends on changes: routes,
+ *   filter rules, device addresses and the device state.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void ipfwd_flow_flush(void)
+{
+  irqstate_t flags = spin_lock_irqsave(&g_flowlock);
+  g_flowgen++;
+  spin_unlock_irqrestore(&g_flowlock, flags);
+}
+
+#endif /* CONFIG_NET_IPFORWARD_FLOWCACHE */
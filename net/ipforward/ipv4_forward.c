@@ -204,6 +204,8 @@ static int ipv4_decr_ttl(FAR struct ipv4_hdr_s *ipv4)
  *              contains the IPv4 packet.
  *   fwdddev  - The device on which the packet must be forwarded.
  *   ipv4     - A pointer to the IPv4 header in within the IPv4 packet
+ *   accepted - True if the FORWARD filter chain already accepted the
+ *              flow of the packet.
  *
  * Returned Value:
  *   Zero is returned if the packet was successfully forward;  A negated
@@ -214,7 +216,7 @@ static int ipv4_decr_ttl(FAR struct ipv4_hdr_s *ipv4)
 
 static int ipv4_dev_forward(FAR struct net_driver_s *dev,
                             FAR struct net_driver_s *fwddev,
-                            FAR struct ipv4_hdr_s *ipv4)
+                            FAR struct ipv4_hdr_s *ipv4, bool accepted)
 {
   FAR struct forward_s *fwd = NULL;
 #ifdef CONFIG_DEBUG_NET_WARN
@@ -232,10 +234,12 @@ static int ipv4_dev_forward(FAR struct net_driver_s *dev,
 
 #ifdef CONFIG_NET_IPFILTER
   /* Do filter before forwarding, to make sure we drop silently before
-   * replying any other errors.
+   * replying any other errors.  Packets of a cached flow were accepted
+   * already.
    */
 
-  ret = ipv4_filter_fwd(dev, fwddev, ipv4);
+  ret = accepted ? IPFILTER_TARGET_ACCEPT :
+                   ipv4_filter_fwd(dev, fwddev, ipv4);
   if (ret < 0)
     {
       ninfo("Drop/Reject FORWARD packet due to filter %d\n", ret);
@@ -417,7 +421,7 @@ static int ipv4_forward_callback(FAR struct net_driver_s *fwddev,
 
       /* Send the packet asynchrously on the forwarding device. */
 
-      ret = ipv4_dev_forward(dev, fwddev, ipv4);
+      ret = ipv4_dev_forward(dev, fwddev, ipv4, false);
       if (ret < 0)
         {
           iob_free_chain(iob);
@@ -472,6 +476,9 @@ int ipv4_forward(FAR struct net_driver_s *dev, FAR struct ipv4_hdr_s *ipv4)
   in_addr_t destipaddr;
   in_addr_t srcipaddr;
   FAR struct net_driver_s *fwddev;
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+  struct ipfwd_flowkey_s key;
+#endif
   int ret;
 #if defined(CONFIG_NET_ICMP) && !defined(CONFIG_NET_ICMP_NO_STACK)
   int icmp_reply_type;
@@ -486,6 +493,23 @@ int ipv4_forward(FAR struct net_driver_s *dev, FAR struct ipv4_hdr_s *ipv4)
       goto drop;
     }
 
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+  /* Packets of a cached flow skip the route lookup and the filter */
+
+  fwddev = ipv4_flow_lookup(dev, ipv4, &key);
+  if (fwddev != NULL)
+    {
+      ret = ipv4_dev_forward(dev, fwddev, ipv4, true);
+      if (ret < 0)
+        {
+          nwarn("WARNING: ipv4_dev_forward failed: %d\n", ret);
+          goto drop;
+        }
+
+      return OK;
+    }
+#endif
+
   /* Search for a device that can forward this packet. */
 
   destipaddr = net_ip4addr_conv32(ipv4->destipaddr);
@@ -507,12 +531,16 @@ int ipv4_forward(FAR struct net_driver_s *dev, FAR struct ipv4_hdr_s *ipv4)
     {
       /* Send the packet asynchrously on the forwarding device. */
 
-      ret = ipv4_dev_forward(dev, fwddev, ipv4);
+      ret = ipv4_dev_forward(dev, fwddev, ipv4, false);
       if (ret < 0)
         {
           nwarn("WARNING: ipv4_dev_forward failed: %d\n", ret);
           goto drop;
         }
+
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+      ipfwd_flow_add(&key, fwddev);
+#endif
     }
   else
     {
@@ -322,6 +322,8 @@ static int ipv6_packet_conversion(FAR struct net_driver_s *dev,
  *              contains the IPv6 packet.
  *   fwdddev  - The device on which the packet must be forwarded.
  *   ipv6     - A pointer to the IPv6 header in within the IPv6 packet
+ *   accepted - True if the FORWARD filter chain already accepted the
+ *              flow of the packet.
  *
  * Returned Value:
  *   Zero is returned if the packet was successfully forwarded;  A negated
@@ -332,7 +334,7 @@ static int ipv6_packet_conversion(FAR struct net_driver_s *dev,
 
 static int ipv6_dev_forward(FAR struct net_driver_s *dev,
                             FAR struct net_driver_s *fwddev,
-                            FAR struct ipv6_hdr_s *ipv6)
+                            FAR struct ipv6_hdr_s *ipv6, bool accepted)
 {
   FAR struct forward_s *fwd = NULL;
 #ifdef CONFIG_DEBUG_NET_WARN
@@ -352,10 +354,12 @@ static int ipv6_dev_forward(FAR struct net_driver_s *dev,
 
 #ifdef CONFIG_NET_IPFILTER
   /* Do filter before forwarding, to make sure we drop silently before
-   * replying any other errors.
+   * replying any other errors.  Packets of a cached flow were accepted
+   * already.
    */
 
-  ret = ipv6_filter_fwd(dev, fwddev, ipv6);
+  ret = accepted ? IPFILTER_TARGET_ACCEPT :
+                   ipv6_filter_fwd(dev, fwddev, ipv6);
   if (ret < 0)
     {
       ninfo("Drop/Reject FORWARD packet due to filter %d\n", ret);
@@ -553,7 +557,7 @@ static int ipv6_forward_callback(FAR struct net_driver_s *fwddev,
 
       /* Send the packet asynchrously on the forwarding device. */
 
-      ret = ipv6_dev_forward(dev, fwddev, ipv6);
+      ret = ipv6_dev_forward(dev, fwddev, ipv6, false);
       if (ret < 0)
         {
           iob_free_chain(iob);
@@ -606,6 +610,9 @@ static int ipv6_forward_callback(FAR struct net_driver_s *fwddev,
 int ipv6_forward(FAR struct net_driver_s *dev, FAR struct ipv6_hdr_s *ipv6)
 {
   FAR struct net_driver_s *fwddev;
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+  struct ipfwd_flowkey_s key;
+#endif
   int ret;
 #ifdef CONFIG_NET_ICMPv6
   int icmpv6_reply_type;
@@ -623,6 +630,23 @@ int ipv6_forward(FAR struct net_driver_s *dev, FAR struct ipv6_hdr_s *ipv6)
       goto drop;
     }
 
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+  /* Packets of a cached flow skip the route lookup and the filter */
+
+  fwddev = ipv6_flow_lookup(dev, ipv6, &key);
+  if (fwddev != NULL)
+    {
+      ret = ipv6_dev_forward(dev, fwddev, ipv6, true);
+      if (ret < 0)
+        {
+          nwarn("WARNING: ipv6_dev_forward failed: %d\n", ret);
+          goto drop;
+        }
+
+      return OK;
+    }
+#endif
+
   /* Search for a device that can forward this packet. */
 
   fwddev = netdev_findby_ripv6addr(ipv6->srcipaddr, ipv6->destipaddr);
@@ -641,12 +665,16 @@ int ipv6_forward(FAR struct net_driver_s *dev, FAR struct ipv6_hdr_s *ipv6)
     {
       /* Send the packet asynchrously on the forwarding device. */
 
-      ret = ipv6_dev_forward(dev, fwddev, ipv6);
+      ret = ipv6_dev_forward(dev, fwddev, ipv6, false);
       if (ret < 0)
         {
           nwarn("WARNING: ipv6_dev_forward failed: %d\n", ret);
           goto drop;
         }
+
+#ifdef CONFIG_NET_IPFORWARD_FLOWCACHE
+      ipfwd_flow_add(&key, fwddev);
+#endif
     }
   else
 #if defined(CONFIG_NET_6LOWPAN) /* REVISIT:  Currently only support for 6LoWPAN */
@@ -1264,6 +1264,16 @@ int32_t ip_fragout(FAR struct net_driver_s *dev)
       return OK;
     }
 
+#ifdef CONFIG_NETDEV_TSO
+  /* TCP super-frames are cut at the MTU by the device, not fragmented */
+
+  if ((dev->d_features & NETDEV_TX_TSO) != 0 &&
+      IFF_IS_IPv4(dev->d_flags) && IPv4BUF->proto == IP_PROTO_TCP)
+    {
+      return OK;
+    }
+#endif
+
   ninfo("pkt size: %d, MTU: %d\n", dev->d_iob->io_pktlen, mtu);
 
 #ifdef CONFIG_NET_IPv4
@@ -108,9 +108,22 @@ void netdev_iob_prepare_dynamic(FAR struct net_driver_s *dev, uint16_t size)
       return;
     }
 
-  /* alloc new iob for jumbo frame */
+  /* alloc new iob for jumbo frame, preferring the large I/O buffers */
+
+#if CONFIG_IOB_LARGE_NBUFFERS > 0
+  iob = iob_tryalloc_len(false, size);
+  if (iob != NULL && size > IOB_BUFSIZE(iob))
+    {
+      iob_free(iob);
+      iob = NULL;
+    }
+
+  if (iob == NULL)
+#endif
+    {
+      iob = iob_alloc_dynamic(size);
+    }
 
-  iob = iob_alloc_dynamic(size);
   if (iob == NULL)
     {
       nerr("ERROR: Failed to allocate an I/O buffer.");
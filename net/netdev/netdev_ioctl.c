@@ -83,6 +83,7 @@
 #include "netdev/netdev.h"
 #include "devif/devif.h"
 #include "igmp/igmp.h"
+#include "ipforward/ipforward.h"
 #include "icmpv6/icmpv6.h"
 #include "route/route.h"
 #include "netlink/netlink.h"
@@ -929,6 +930,7 @@ static int netdev_ifr_ioctl(FAR struct socket *psock, int cmd,
 
       case SIOCSIFDSTADDR:  /* Set P-to-P address */
         ioctl_set_ipv4addr(&dev->d_draddr, &req->ifr_dstaddr);
+        ipfwd_flow_flush();
         break;
 
       case SIOCGIFBRDADDR:  /* Get broadcast IP address */
@@ -946,6 +948,7 @@ static int netdev_ifr_ioctl(FAR struct socket *psock, int cmd,
 
       case SIOCSIFNETMASK:  /* Set network mask */
         ioctl_set_ipv4addr(&dev->d_netmask, &req->ifr_addr);
+        ipfwd_flow_flush();
         break;
 #endif
 
@@ -1162,6 +1165,7 @@ static int netdev_ifr_ioctl(FAR struct socket *psock, int cmd,
               }
 
             ioctl_set_ipv4addr(&dev->d_ipaddr, &req->ifr_addr);
+            ipfwd_flow_flush();
             netlink_device_notify_ipaddr(dev, RTM_NEWADDR, AF_INET,
                          &dev->d_ipaddr, net_ipv4_mask2pref(dev->d_netmask));
 
@@ -1193,6 +1197,7 @@ static int netdev_ifr_ioctl(FAR struct socket *psock, int cmd,
             netlink_device_notify_ipaddr(dev, RTM_DELADDR, AF_INET,
                          &dev->d_ipaddr, net_ipv4_mask2pref(dev->d_netmask));
             dev->d_ipaddr = 0;
+            ipfwd_flow_flush();
           }
 #endif
 
@@ -2051,6 +2056,7 @@ int netdev_ifup(FAR struct net_driver_s *dev)
               /* Mark the interface as up */
 
               dev->d_flags |= IFF_UP;
+              ipfwd_flow_flush();
 
               /* Update the driver status */
 
@@ -2085,6 +2091,7 @@ int netdev_ifdown(FAR struct net_driver_s *dev)
               /* Mark the interface as down */
 
               dev->d_flags &= ~(IFF_UP | IFF_RUNNING);
+              ipfwd_flow_flush();
 
               /* Update the driver status */
 
@@ -33,6 +33,7 @@
 #include <nuttx/net/netdev.h>
 
 #include "inet/inet.h"
+#include "ipforward/ipforward.h"
 #include "netdev/netdev.h"
 #include "utils/utils.h"
 
@@ -181,6 +182,7 @@ int netdev_ipv6_add(FAR struct net_driver_s *dev, const net_ipv6addr_t addr,
        */
 
       net_ipv6_pref2mask(ifaddr->mask, preflen);
+      ipfwd_flow_flush();
       return OK;
     }
 
@@ -215,6 +217,7 @@ int netdev_ipv6_add(FAR struct net_driver_s *dev, const net_ipv6addr_t addr,
   net_ipv6_pref2mask(ifaddr->mask, preflen);
 
   netdev_ipv6_addmcastmac(dev, addr);
+  ipfwd_flow_flush();
 
   return OK;
 }
@@ -254,6 +257,7 @@ int netdev_ipv6_del(FAR struct net_driver_s *dev, const net_ipv6addr_t addr,
   net_ipv6addr_copy(ifaddr->mask, g_ipv6_unspecaddr);
 
   netdev_ipv6_removemcastmac(dev, addr);
+  ipfwd_flow_flush();
 
   return OK;
 }
@@ -25,6 +25,7 @@
  ****************************************************************************/
 
 #include <assert.h>
+#include <errno.h>
 #include <nuttx/debug.h>
 
 #include "netdev/netdev.h"
@@ -430,7 +431,10 @@ void netdev_notify_recvcpu(FAR struct net_driver_s *dev,
 
       ret = dev->d_ioctl(dev, SIOCNOTIFYRECVCPU,
                          (unsigned long)(uintptr_t)&arg);
-      if (ret < 0)
+
+      /* Drivers that cannot steer flows do not implement the ioctl */
+
+      if (ret < 0 && ret != -ENOTTY)
         {
           nerr("ERROR: SIOCNOTIFYRECVCPU failed: %d\n", ret);
         }
@@ -64,6 +64,23 @@ struct pkt_poll_s
   FAR struct devif_callback_s *cb;   /* Needed to teardown the poll */
 };
 
+#ifdef CONFIG_NET_PKT_MMAP
+/* One memory-mapped frame ring (PACKET_RX_RING or PACKET_TX_RING) */
+
+struct pkt_ring_s
+{
+  FAR uint8_t *base;        /* First frame, NULL if there is no ring */
+  size_t       size;        /* Size of the ring in bytes */
+  uint32_t     block_size;  /* Size of one block */
+  uint32_t     frame_size;  /* Size of one frame */
+  uint32_t     frame_nr;    /* Number of frames */
+  uint32_t     frame_bnr;   /* Number of frames per block */
+  uint32_t     head;        /* Next frame to fill (RX) or to send (TX) */
+};
+
+struct pkt_ringbuf_s;       /* Forward reference */
+#endif
+
 struct pkt_conn_s
 {
   /* Common prologue of all connection structures. */
@@ -99,11 +116,21 @@ struct pkt_conn_s
    *   readahead - A singly linked list of type struct iob_qentry_s
    *               where the PKT read-ahead data is retained.
    *
-   * TODO: Maybe support PACKET_MMAP for further optimize.
    */
 
   struct iob_queue_s readahead;   /* Read-ahead buffering */
 
+#ifdef CONFIG_NET_PKT_MMAP
+  /* Memory-mapped rings.  When an RX ring is present, received frames are
+   * placed in the ring instead of the read-ahead queue.
+   */
+
+  FAR struct pkt_ringbuf_s *ringbuf; /* Memory holding both rings */
+  struct pkt_ring_s rxring;          /* Receive ring */
+  struct pkt_ring_s txring;          /* Transmit ring */
+  bool               rxlosing;       /* RX frames were dropped */
+#endif
+
   FAR struct iob_s  *pendiob;     /* The iob currently being sent */
 
   /* The following is a list of poll structures of threads waiting for
@@ -400,6 +427,77 @@ int pkt_pollteardown(FAR struct socket *psock, FAR struct pollfd *fds);
 ssize_t pkt_sendmsg(FAR struct socket *psock, FAR const struct msghdr *msg,
                     int flags);
 
+#ifdef CONFIG_NET_PKT_MMAP
+/****************************************************************************
+ * Name: pkt_ring_setup
+ *
+ * Description:
+ *   Create, resize or release (tp_block_nr == 0) the RX or TX ring of a
+ *   packet connection.  The rings can not be changed while mapped.
+ *
+ ****************************************************************************/
+
+struct tpacket_req;
+int pkt_ring_setup(FAR struct pkt_conn_s *conn, int option,
+                   FAR const struct tpacket_req *req);
+
+/****************************************************************************
+ * Name: pkt_ring_free
+ *
+ * Description:
+ *   Drop the connection's reference to its rings.
+ *
+ ****************************************************************************/
+
+void pkt_ring_free(FAR struct pkt_conn_s *conn);
+
+/****************************************************************************
+ * Name: pkt_ring_input
+ *
+ * Description:
+ *   Copy the received frame into the RX ring.  Returns the number of bytes
+ *   consumed, zero if the ring is full.
+ *
+ ****************************************************************************/
+
+uint16_t pkt_ring_input(FAR struct net_driver_s *dev,
+                        FAR struct pkt_conn_s *conn);
+
+/****************************************************************************
+ * Name: pkt_ring_rxavail
+ *
+ * Description:
+ *   Return true if the RX ring holds a frame for the application.
+ *
+ ****************************************************************************/
+
+bool pkt_ring_rxavail(FAR struct pkt_conn_s *conn);
+
+/****************************************************************************
+ * Name: pkt_ring_sendmsg
+ *
+ * Description:
+ *   The si_sendmsg method of packet sockets with CONFIG_NET_PKT_MMAP.  A
+ *   zero-length send flushes the TX ring, anything else is passed to
+ *   pkt_sendmsg().
+ *
+ ****************************************************************************/
+
+ssize_t pkt_ring_sendmsg(FAR struct socket *psock,
+                         FAR const struct msghdr *msg, int flags);
+
+/****************************************************************************
+ * Name: pkt_ring_mmap
+ *
+ * Description:
+ *   The si_mmap method of packet sockets: map the RX ring followed by the
+ *   TX ring into the caller.
+ *
+ ****************************************************************************/
+
+int pkt_ring_mmap(FAR struct socket *psock, FAR struct mm_map_entry_s *map);
+#endif
+
 #ifdef CONFIG_NET_PKTPROTO_OPTIONS
 /****************************************************************************
  * Name: pkt_getsockopt
@@ -135,6 +135,12 @@ void pkt_free(FAR struct pkt_conn_s *conn)
   iob_free_queue(&conn->write_q);
 #endif
 
+#ifdef CONFIG_NET_PKT_MMAP
+  /* Release the rings unless they are still mapped */
+
+  pkt_ring_free(conn);
+#endif
+
   /* Free the connection. */
 
   NET_BUFPOOL_FREE(g_pkt_connections, conn);
@@ -196,9 +196,24 @@ static int pkt_in(FAR struct net_driver_s *dev)
 
       if ((flags & PKT_NEWDATA) != 0)
         {
-          /* Add the PKT to the socket read-ahead buffer. */
+          uint16_t buflen;
 
-          if (pkt_datahandler(dev, conn) == 0)
+#ifdef CONFIG_NET_PKT_MMAP
+          /* Place the frame in the RX ring if the socket has one */
+
+          if (conn->rxring.base != NULL)
+            {
+              buflen = pkt_ring_input(dev, conn);
+            }
+          else
+#endif
+            {
+              /* Add the PKT to the socket read-ahead buffer. */
+
+              buflen = pkt_datahandler(dev, conn);
+            }
+
+          if (buflen == 0)
             {
               /* No.. the packet was not processed now.  Return -EAGAIN so
                * that the driver may retry again later.
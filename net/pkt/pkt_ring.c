@@ -0,0 +1,532 @@
+/****************************************************************************
+ * net/pkt/pkt_ring.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/param.h>
+#include <sys/socket.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <assert.h>
+#include <nuttx/debug.h>
+
+#include <netpacket/packet.h>
+#include <nuttx/arch.h>
+#include <nuttx/atomic.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/sched.h>
+#include <nuttx/mm/iob.h>
+#include <nuttx/mm/map.h>
+#include <nuttx/net/netdev.h>
+#include <nuttx/net/ethernet.h>
+
+#include "socket/socket.h"
+#include "utils/utils.h"
+#include "pkt/pkt.h"
+
+#ifdef CONFIG_NET_PKT_MMAP
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Offset of the frame data in the frames of a transmit ring */
+
+#define PKT_RING_TXOFF  TPACKET_ALIGN(sizeof(struct tpacket2_hdr))
+
+/* Offset of the link layer header in the frames of a receive ring */
+
+#define PKT_RING_RXOFF  TPACKET_ALIGN(TPACKET2_HDRLEN)
+
+/* The frames follow the ring buffer header */
+
+#define PKT_RINGBUF_HDRLEN  TPACKET_ALIGN(sizeof(struct pkt_ringbuf_s))
+#define PKT_RINGBUF_DATA(b) ((FAR uint8_t *)(b) + PKT_RINGBUF_HDRLEN)
+
+/* The frame status word is shared with the application */
+
+#define PKT_RING_STATUS(h)  (*(FAR volatile uint32_t *)&(h)->tp_status)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The memory holding the RX ring followed by the TX ring.  It is released
+ * when both the connection and all of the mappings have dropped it, so an
+ * application that closes the socket before munmap() never sees the memory
+ * go away under its feet.
+ */
+
+struct pkt_ringbuf_s
+{
+  atomic_t crefs;  /* One for the connection plus one per mapping */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pkt_ringbuf_release
+ ****************************************************************************/
+
+static void pkt_ringbuf_release(FAR struct pkt_ringbuf_s *buf)
+{
+  if (buf != NULL && atomic_fetch_sub(&buf->crefs, 1) == 1)
+    {
+      kumm_free(buf);
+    }
+}
+
+/****************************************************************************
+ * Name: pkt_ring_frame
+ *
+ * Description:
+ *   Return the header of frame 'index'.  Frames never straddle two blocks.
+ *
+ ****************************************************************************/
+
+static FAR struct tpacket2_hdr *
+pkt_ring_frame(FAR struct pkt_ring_s *ring, uint32_t index)
+{
+  return (FAR struct tpacket2_hdr *)
+    (ring->base + (index / ring->frame_bnr) * ring->block_size +
+     (index % ring->frame_bnr) * ring->frame_size);
+}
+
+/****************************************************************************
+ * Name: pkt_ring_config
+ *
+ * Description:
+ *   Validate a ring request and describe the resulting ring.
+ *
+ ****************************************************************************/
+
+static int pkt_ring_config(FAR struct pkt_ring_s *ring,
+                           FAR const struct tpacket_req *req)
+{
+  uint64_t size;
+
+  memset(ring, 0, sizeof(struct pkt_ring_s));
+  if (req->tp_block_nr == 0)
+    {
+      return OK;
+    }
+
+  if (req->tp_frame_size < PKT_RING_RXOFF ||
+      req->tp_frame_size % TPACKET_ALIGNMENT != 0 ||
+      req->tp_block_size < req->tp_frame_size ||
+      req->tp_block_size % TPACKET_ALIGNMENT != 0)
+    {
+      return -EINVAL;
+    }
+
+  ring->frame_bnr = req->tp_block_size / req->tp_frame_size;
+  if ((uint64_t)ring->frame_bnr * req->tp_block_nr != req->tp_frame_nr)
+    {
+      return -EINVAL;
+    }
+
+  size = (uint64_t)req->tp_block_size * req->tp_block_nr;
+  if (size > UINT32_MAX)
+    {
+      return -ENOMEM;
+    }
+
+  ring->size       = size;
+  ring->block_size = req->tp_block_size;
+  ring->frame_size = req->tp_frame_size;
+  ring->frame_nr   = req->tp_frame_nr;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: pkt_ring_munmap
+ ****************************************************************************/
+
+static int pkt_ring_munmap(FAR struct task_group_s *group,
+                           FAR struct mm_map_entry_s *entry,
+                           FAR void *start, size_t length)
+{
+  FAR struct pkt_ringbuf_s *buf = entry->priv.p;
+  int ret;
+
+  ret = mm_map_remove(get_group_mm(group), entry);
+  pkt_ringbuf_release(buf);
+  return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pkt_ring_setup
+ *
+ * Description:
+ *   Create, resize or release (tp_block_nr == 0) the RX or TX ring of a
+ *   packet connection.  The rings can not be changed while mapped.
+ *
+ * Input Parameters:
+ *   conn   - The packet connection
+ *   option - PACKET_RX_RING or PACKET_TX_RING
+ *   req    - The requested ring geometry
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int pkt_ring_setup(FAR struct pkt_conn_s *conn, int option,
+                   FAR const struct tpacket_req *req)
+{
+  FAR struct pkt_ringbuf_s *buf = NULL;
+  struct pkt_ring_s rxring;
+  struct pkt_ring_s txring;
+  int ret;
+
+  conn_lock(&conn->sconn);
+
+  if (conn->ringbuf != NULL && atomic_read(&conn->ringbuf->crefs) > 1)
+    {
+      ret = -EBUSY;
+      goto errout_with_lock;
+    }
+
+  rxring = conn->rxring;
+  txring = conn->txring;
+
+  ret = pkt_ring_config(option == PACKET_RX_RING ? &rxring : &txring,
+                        req);
+  if (ret < 0)
+    {
+      goto errout_with_lock;
+    }
+
+  if (rxring.size + txring.size > 0)
+    {
+      buf = kumm_memalign(TPACKET_ALIGNMENT,
+                          PKT_RINGBUF_HDRLEN + rxring.size + txring.size);
+      if (buf == NULL)
+        {
+          ret = -ENOMEM;
+          goto errout_with_lock;
+        }
+
+      /* All frames start out as TP_STATUS_KERNEL / TP_STATUS_AVAILABLE */
+
+      memset(buf, 0, PKT_RINGBUF_HDRLEN + rxring.size + txring.size);
+      atomic_set(&buf->crefs, 1);
+
+      rxring.base = rxring.size > 0 ? PKT_RINGBUF_DATA(buf) : NULL;
+      txring.base = txring.size > 0 ?
+                    PKT_RINGBUF_DATA(buf) + rxring.size : NULL;
+    }
+
+  rxring.head = 0;
+  txring.head = 0;
+
+  pkt_ringbuf_release(conn->ringbuf);
+  conn->ringbuf  = buf;
+  conn->rxring   = rxring;
+  conn->txring   = txring;
+  conn->rxlosing = false;
+
+errout_with_lock:
+  conn_unlock(&conn->sconn);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: pkt_ring_free
+ *
+ * Description:
+ *   Drop the connection's reference to the rings.  The memory stays valid
+ *   until the application unmaps it.
+ *
+ ****************************************************************************/
+
+void pkt_ring_free(FAR struct pkt_conn_s *conn)
+{
+  pkt_ringbuf_release(conn->ringbuf);
+  conn->ringbuf = NULL;
+  memset(&conn->rxring, 0, sizeof(struct pkt_ring_s));
+  memset(&conn->txring, 0, sizeof(struct pkt_ring_s));
+}
+
+/****************************************************************************
+ * Name: pkt_ring_input
+ *
+ * Description:
+ *   Copy the received frame in the device buffer into the next free slot
+ *   of the RX ring and hand the slot over to the application.
+ *
+ * Input Parameters:
+ *   dev  - The device driver structure containing the received frame
+ *   conn - The packet connection owning the RX ring
+ *
+ * Returned Value:
+ *   The number of bytes consumed, zero if the ring is full.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+uint16_t pkt_ring_input(FAR struct net_driver_s *dev,
+                        FAR struct pkt_conn_s *conn)
+{
+  FAR struct pkt_ring_s *ring = &conn->rxring;
+  FAR struct tpacket2_hdr *hdr;
+  FAR struct sockaddr_ll *sll;
+  uint16_t llhdrlen = NET_LL_HDRLEN(dev);
+  uint16_t ret = 0;
+  int ncopy;
+
+  conn_lock(&conn->sconn);
+
+  if (ring->base == NULL)
+    {
+      goto out;
+    }
+
+  hdr = pkt_ring_frame(ring, ring->head);
+  if (PKT_RING_STATUS(hdr) != TP_STATUS_KERNEL)
+    {
+      /* The application has not drained the ring yet; the frame is lost */
+
+      conn->rxlosing = true;
+      goto out;
+    }
+
+  UP_DMB();
+
+  ncopy = iob_copyout((FAR uint8_t *)hdr + PKT_RING_RXOFF, dev->d_iob,
+                      MIN(dev->d_len, ring->frame_size - PKT_RING_RXOFF),
+                      -llhdrlen);
+  if (ncopy < 0)
+    {
+      nerr("ERROR: Failed to copy the frame: %d\n", ncopy);
+      goto out;
+    }
+
+  hdr->tp_len       = dev->d_len;
+  hdr->tp_snaplen   = ncopy;
+  hdr->tp_mac       = PKT_RING_RXOFF;
+  hdr->tp_net       = PKT_RING_RXOFF + llhdrlen;
+#ifdef CONFIG_NET_TIMESTAMP
+  hdr->tp_sec       = dev->d_rxtime.tv_sec;
+  hdr->tp_nsec      = dev->d_rxtime.tv_nsec;
+#else
+  hdr->tp_sec       = 0;
+  hdr->tp_nsec      = 0;
+#endif
+  hdr->tp_vlan_tci  = 0;
+  hdr->tp_vlan_tpid = 0;
+
+  sll = (FAR struct sockaddr_ll *)((FAR uint8_t *)hdr + PKT_RING_TXOFF);
+  memset(sll, 0, sizeof(struct sockaddr_ll));
+  sll->sll_family  = AF_PACKET;
+  sll->sll_ifindex = dev->d_ifindex;
+  sll->sll_pkttype = PACKET_HOST;
+
+#ifdef CONFIG_NET_ETHERNET
+  if (dev->d_lltype == NET_LL_ETHERNET && ncopy >= ETH_HDRLEN)
+    {
+      FAR struct eth_hdr_s *eth =
+        (FAR struct eth_hdr_s *)((FAR uint8_t *)hdr + PKT_RING_RXOFF);
+
+      sll->sll_protocol = eth->type;
+      sll->sll_halen    = ETHER_ADDR_LEN;
+      memcpy(sll->sll_addr, eth->src, ETHER_ADDR_LEN);
+    }
+#endif
+
+  /* Publish the frame data before giving the slot to the application */
+
+  UP_WMB();
+  PKT_RING_STATUS(hdr) = TP_STATUS_USER |
+                         (conn->rxlosing ? TP_STATUS_LOSING : 0);
+
+  conn->rxlosing = false;
+  ring->head     = (ring->head + 1) % ring->frame_nr;
+  ret            = dev->d_len;
+
+out:
+  conn_unlock(&conn->sconn);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: pkt_ring_rxavail
+ *
+ * Description:
+ *   Return true if the RX ring holds a frame not yet consumed by the
+ *   application.
+ *
+ ****************************************************************************/
+
+bool pkt_ring_rxavail(FAR struct pkt_conn_s *conn)
+{
+  FAR struct pkt_ring_s *ring = &conn->rxring;
+
+  return ring->base != NULL &&
+         PKT_RING_STATUS(pkt_ring_frame(ring, ring->head)) !=
+         TP_STATUS_KERNEL;
+}
+
+/****************************************************************************
+ * Name: pkt_ring_sendmsg
+ *
+ * Description:
+ *   The si_sendmsg method of packet sockets.  A zero-length send on a
+ *   socket with a TX ring transmits every frame the application marked
+ *   TP_STATUS_SEND_REQUEST, in ring order, and returns the total number of
+ *   bytes sent.  Anything else is handed to pkt_sendmsg().
+ *
+ ****************************************************************************/
+
+ssize_t pkt_ring_sendmsg(FAR struct socket *psock,
+                         FAR const struct msghdr *msg, int flags)
+{
+  FAR struct pkt_conn_s *conn = psock->s_conn;
+  FAR struct pkt_ring_s *ring;
+  FAR struct tpacket2_hdr *hdr;
+  struct msghdr framemsg;
+  struct iovec iov;
+  ssize_t total = 0;
+  ssize_t ret = 0;
+
+  if (conn == NULL || conn->txring.base == NULL ||
+      msg->msg_iovlen != 1 || msg->msg_iov->iov_len != 0)
+    {
+      return pkt_sendmsg(psock, msg, flags);
+    }
+
+  ring     = &conn->txring;
+  framemsg = *msg;
+  framemsg.msg_iov = &iov;
+
+  for (; ; )
+    {
+      hdr = pkt_ring_frame(ring, ring->head);
+      if (PKT_RING_STATUS(hdr) != TP_STATUS_SEND_REQUEST)
+        {
+          break;
+        }
+
+      UP_DMB();
+
+      if (hdr->tp_len == 0 ||
+          hdr->tp_len > ring->frame_size - PKT_RING_TXOFF)
+        {
+          ret = -EMSGSIZE;
+        }
+      else
+        {
+          PKT_RING_STATUS(hdr) = TP_STATUS_SENDING;
+
+          iov.iov_base = (FAR uint8_t *)hdr + PKT_RING_TXOFF;
+          iov.iov_len  = hdr->tp_len;
+
+          ret = pkt_sendmsg(psock, &framemsg, flags);
+          if (ret == -EAGAIN)
+            {
+              /* Leave the frame queued for the next send() */
+
+              PKT_RING_STATUS(hdr) = TP_STATUS_SEND_REQUEST;
+              break;
+            }
+        }
+
+      UP_WMB();
+      if (ret < 0)
+        {
+          PKT_RING_STATUS(hdr) = TP_STATUS_WRONG_FORMAT;
+        }
+      else
+        {
+          PKT_RING_STATUS(hdr) = TP_STATUS_AVAILABLE;
+          total += ret;
+        }
+
+      ring->head = (ring->head + 1) % ring->frame_nr;
+      if (ret < 0)
+        {
+          break;
+        }
+    }
+
+  return total > 0 ? total : ret;
+}
+
+/****************************************************************************
+ * Name: pkt_ring_mmap
+ *
+ * Description:
+ *   The si_mmap method of packet sockets.  Offset zero is the first frame
+ *   of the RX ring; the TX ring immediately follows the RX ring.
+ *
+ ****************************************************************************/
+
+int pkt_ring_mmap(FAR struct socket *psock, FAR struct mm_map_entry_s *map)
+{
+  FAR struct pkt_conn_s *conn = psock->s_conn;
+  FAR struct pkt_ringbuf_s *buf;
+  int ret;
+
+  if (conn == NULL)
+    {
+      return -EBADF;
+    }
+
+  conn_lock(&conn->sconn);
+
+  buf = conn->ringbuf;
+  if (buf == NULL || map->offset < 0 ||
+      map->offset + map->length > conn->rxring.size + conn->txring.size)
+    {
+      ret = -EINVAL;
+      goto out;
+    }
+
+  map->vaddr  = PKT_RINGBUF_DATA(buf) + map->offset;
+  map->priv.p = buf;
+  map->munmap = pkt_ring_munmap;
+
+  ret = mm_map_add(get_current_mm(), map);
+  if (ret >= 0)
+    {
+      atomic_fetch_add(&buf->crefs, 1);
+    }
+
+out:
+  conn_unlock(&conn->sconn);
+  return ret;
+}
+
+#endif /* CONFIG_NET_PKT_MMAP */
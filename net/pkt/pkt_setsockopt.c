@@ -123,6 +123,21 @@ int pkt_setsockopt(FAR struct socket *psock, int level, int option,
         }
 #endif
 
+#ifdef CONFIG_NET_PKT_MMAP
+      case PACKET_RX_RING:
+      case PACKET_TX_RING:
+        {
+          if (value == NULL || value_len < sizeof(struct tpacket_req))
+            {
+              return -EINVAL;
+            }
+
+          ret = pkt_ring_setup(psock->s_conn, option,
+                               (FAR const struct tpacket_req *)value);
+        }
+        break;
+#endif
+
 #ifdef CONFIG_NET_MCASTGROUP
       case PACKET_ADD_MEMBERSHIP:
       case PACKET_DROP_MEMBERSHIP:
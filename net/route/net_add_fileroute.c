@@ -35,6 +35,7 @@
 #include <nuttx/fs/fs.h>
 #include <nuttx/net/ip.h>
 
+#include "ipforward/ipforward.h"
 #include "netlink/netlink.h"
 #include "route/fileroute.h"
 #include "route/route.h"
@@ -89,6 +90,7 @@ int net_addroute_ipv4(in_addr_t target, in_addr_t netmask, in_addr_t router)
   net_closeroute_ipv4(&fshandle);
 
   netlink_route_notify(&route, RTM_NEWROUTE, AF_INET);
+  ipfwd_flow_flush();
   return nwritten >= 0 ? 0 : (int)nwritten;
 }
 #endif
@@ -125,6 +127,7 @@ int net_addroute_ipv6(net_ipv6addr_t target, net_ipv6addr_t netmask,
   net_closeroute_ipv6(&fshandle);
 
   netlink_route_notify(&route, RTM_NEWROUTE, AF_INET6);
+  ipfwd_flow_flush();
   return nwritten >= 0 ? 0 : (int)nwritten;
 }
 #endif
@@ -36,9 +36,11 @@
 
 #include <arch/irq.h>
 
+#include "ipforward/ipforward.h"
 #include "netlink/netlink.h"
 #include "route/ramroute.h"
 #include "route/route.h"
+#include "route/trieroute.h"
 
 #if defined(CONFIG_ROUTE_IPv4_RAMROUTE) || defined(CONFIG_ROUTE_IPv6_RAMROUTE)
 
@@ -63,6 +65,9 @@
 int net_addroute_ipv4(in_addr_t target, in_addr_t netmask, in_addr_t router)
 {
   FAR struct net_route_ipv4_s *route;
+#ifdef ROUTE_IPv4_TRIE
+  int ret;
+#endif
 
   /* Allocate a route entry */
 
@@ -84,6 +89,16 @@ int net_addroute_ipv4(in_addr_t target, in_addr_t netmask, in_addr_t router)
 
   net_lockroute_ipv4();
 
+#ifdef ROUTE_IPv4_TRIE
+  ret = net_trieroute_add_ipv4(route);
+  if (ret < 0)
+    {
+      net_unlockroute_ipv4();
+      net_freeroute_ipv4(route);
+      return ret;
+    }
+#endif
+
   /* Then add the new entry to the table */
 
   ramroute_ipv4_addlast((FAR struct net_route_ipv4_entry_s *)route,
@@ -91,6 +106,7 @@ int net_addroute_ipv4(in_addr_t target, in_addr_t netmask, in_addr_t router)
   net_unlockroute_ipv4();
 
   netlink_route_notify(route, RTM_NEWROUTE, AF_INET);
+  ipfwd_flow_flush();
   return OK;
 }
 #endif
@@ -100,6 +116,9 @@ int net_addroute_ipv6(net_ipv6addr_t target, net_ipv6addr_t netmask,
                       net_ipv6addr_t router)
 {
   FAR struct net_route_ipv6_s *route;
+#ifdef ROUTE_IPv6_TRIE
+  int ret;
+#endif
 
   /* Allocate a route entry */
 
@@ -121,11 +140,22 @@ int net_addroute_ipv6(net_ipv6addr_t target, net_ipv6addr_t netmask,
 
   net_lockroute_ipv6();
 
+#ifdef ROUTE_IPv6_TRIE
+  ret = net_trieroute_add_ipv6(route);
+  if (ret < 0)
+    {
+      net_unlockroute_ipv6();
+      net_freeroute_ipv6(route);
+      return ret;
+    }
+#endif
+
   ramroute_ipv6_addlast((FAR struct net_route_ipv6_entry_s *)route,
                         &g_ipv6_routes);
   net_unlockroute_ipv6();
 
   netlink_route_notify(route, RTM_NEWROUTE, AF_INET6);
+  ipfwd_flow_flush();
   return OK;
 }
 #endif
@@ -38,6 +38,7 @@
 #include <nuttx/fs/fs.h>
 #include <nuttx/net/ip.h>
 
+#include "ipforward/ipforward.h"
 #include "netlink/netlink.h"
 #include "route/fileroute.h"
 #include "route/cacheroute.h"
@@ -317,6 +318,7 @@ int net_delroute_ipv4(in_addr_t target, in_addr_t netmask)
   ret = file_truncate(&fshandle, filesize);
 
   netlink_route_notify(&match, RTM_DELROUTE, AF_INET);
+  ipfwd_flow_flush();
 
 errout_with_fshandle:
   net_closeroute_ipv4(&fshandle);
@@ -470,6 +472,7 @@ int net_delroute_ipv6(net_ipv6addr_t target, net_ipv6addr_t netmask)
   ret = file_truncate(&fshandle, filesize);
 
   netlink_route_notify(&match, RTM_DELROUTE, AF_INET6);
+  ipfwd_flow_flush();
 
 errout_with_fshandle:
   net_closeroute_ipv6(&fshandle);
@@ -34,9 +34,11 @@
 #include <arpa/inet.h>
 #include <nuttx/net/ip.h>
 
+#include "ipforward/ipforward.h"
 #include "netlink/netlink.h"
 #include "route/ramroute.h"
 #include "route/route.h"
+#include "route/trieroute.h"
 
 #if defined(CONFIG_ROUTE_IPv4_RAMROUTE) || defined(CONFIG_ROUTE_IPv6_RAMROUTE)
 
@@ -113,7 +115,12 @@ static int net_del_ipv4route(FAR struct net_route_ipv4_s *route,
           ramroute_ipv4_remfirst(&g_ipv4_routes);
         }
 
+#ifdef ROUTE_IPv4_TRIE
+      net_trieroute_del_ipv4(route);
+#endif
+
       netlink_route_notify(route, RTM_DELROUTE, AF_INET);
+      ipfwd_flow_flush();
 
       /* And free the routing table entry by adding it to the free list */
 
@@ -171,7 +178,12 @@ static int net_del_ipv6route(FAR struct net_route_ipv6_s *route,
           ramroute_ipv6_remfirst(&g_ipv6_routes);
         }
 
+#ifdef ROUTE_IPv6_TRIE
+      net_trieroute_del_ipv6(route);
+#endif
+
       netlink_route_notify(route, RTM_DELROUTE, AF_INET6);
+      ipfwd_flow_flush();
 
       /* And free the routing table entry by adding it to the free list */
 
@@ -37,6 +37,7 @@
 #include "devif/devif.h"
 #include "route/cacheroute.h"
 #include "route/route.h"
+#include "route/trieroute.h"
 #include "utils/utils.h"
 
 #if defined(CONFIG_NET) && defined(CONFIG_NET_ROUTE)
@@ -61,7 +62,7 @@
  * Private Types
  ****************************************************************************/
 
-#ifdef CONFIG_NET_IPv4
+#if defined(CONFIG_NET_IPv4) && !defined(ROUTE_IPv4_TRIE)
 struct route_ipv4_match_s
 {
   in_addr_t target;              /* Target IPv4 address on remote network */
@@ -81,7 +82,7 @@ struct route_ipv4_match_s
 };
 #endif
 
-#ifdef CONFIG_NET_IPv6
+#if defined(CONFIG_NET_IPv6) && !defined(ROUTE_IPv6_TRIE)
 struct route_ipv6_match_s
 {
   net_ipv6addr_t target;         /* Target IPv6 address on remote network */
@@ -120,7 +121,7 @@ struct route_ipv6_match_s
  *
  ****************************************************************************/
 
-#ifdef CONFIG_NET_IPv4
+#if defined(CONFIG_NET_IPv4) && !defined(ROUTE_IPv4_TRIE)
 static int net_ipv4_match(FAR struct net_route_ipv4_s *route, FAR void *arg)
 {
   FAR struct route_ipv4_match_s *match =
@@ -160,7 +161,7 @@ static int net_ipv4_match(FAR struct net_route_ipv4_s *route, FAR void *arg)
 
   return 0;
 }
-#endif /* CONFIG_NET_IPv4 */
+#endif /* CONFIG_NET_IPv4 && !ROUTE_IPv4_TRIE */
 
 /****************************************************************************
  * Name: net_ipv6_match
@@ -177,7 +178,7 @@ static int net_ipv4_match(FAR struct net_route_ipv4_s *route, FAR void *arg)
  *
  ****************************************************************************/
 
-#ifdef CONFIG_NET_IPv6
+#if defined(CONFIG_NET_IPv6) && !defined(ROUTE_IPv6_TRIE)
 static int net_ipv6_match(FAR struct net_route_ipv6_s *route, FAR void *arg)
 {
   FAR struct route_ipv6_match_s *match =
@@ -217,7 +218,7 @@ static int net_ipv6_match(FAR struct net_route_ipv6_s *route, FAR void *arg)
 
   return 0;
 }
-#endif /* CONFIG_NET_IPv6 */
+#endif /* CONFIG_NET_IPv6 && !ROUTE_IPv6_TRIE */
 
 /****************************************************************************
  * Public Functions
@@ -247,8 +248,10 @@ static int net_ipv6_match(FAR struct net_route_ipv6_s *route, FAR void *arg)
 int net_ipv4_router(in_addr_t target, FAR in_addr_t *router,
                     int8_t prefixlen)
 {
+#ifndef ROUTE_IPv4_TRIE
   struct route_ipv4_match_s match;
   int ret;
+#endif
 
   /* Just early return for long prefix, maybe already got exact match. */
 
@@ -264,6 +267,11 @@ int net_ipv4_router(in_addr_t target, FAR in_addr_t *router,
       return -ENOENT;
     }
 
+#ifdef ROUTE_IPv4_TRIE
+  /* The trie walk finds the longest match directly */
+
+  return net_trieroute_ipv4(target, router, prefixlen);
+#else
   /* Set up the comparison structure */
 
   memset(&match, 0, sizeof(struct route_ipv4_match_s));
@@ -314,6 +322,7 @@ int net_ipv4_router(in_addr_t target, FAR in_addr_t *router,
 
   net_ipv4addr_copy(*router, match.IPv4_ROUTER);
   return OK;
+#endif /* ROUTE_IPv4_TRIE */
 }
 #endif /* CONFIG_NET_IPv4 */
 
@@ -341,8 +350,10 @@ int net_ipv4_router(in_addr_t target, FAR in_addr_t *router,
 int net_ipv6_router(const net_ipv6addr_t target, net_ipv6addr_t router,
                     int16_t prefixlen)
 {
+#ifndef ROUTE_IPv6_TRIE
   struct route_ipv6_match_s match;
   int ret;
+#endif
 
   /* Just early return for long prefix, maybe already got exact match. */
 
@@ -358,6 +369,11 @@ int net_ipv6_router(const net_ipv6addr_t target, net_ipv6addr_t router,
       return -ENOENT;
     }
 
+#ifdef ROUTE_IPv6_TRIE
+  /* The trie walk finds the longest match directly */
+
+  return net_trieroute_ipv6(target, router, prefixlen);
+#else
   /* Set up the comparison structure */
 
   memset(&match, 0, sizeof(struct route_ipv6_match_s));
@@ -408,6 +424,7 @@ int net_ipv6_router(const net_ipv6addr_t target, net_ipv6addr_t router,
 
   net_ipv6addr_copy(router, match.IPv6_ROUTER);
   return OK;
+#endif /* ROUTE_IPv6_TRIE */
 }
 #endif /* CONFIG_NET_IPv6 */
 
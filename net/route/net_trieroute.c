@@ -0,0 +1,520 @@
+/****************************************************************************
+ * net/route/net_trieroute.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <errno.h>
+#include <nuttx/debug.h>
+
+#include <nuttx/net/ip.h>
+
+#include "route/ramroute.h"
+#include "route/route.h"
+#include "route/trieroute.h"
+#include "utils/utils.h"
+
+#if defined(ROUTE_IPv4_TRIE) || defined(ROUTE_IPv6_TRIE)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Keys are addresses in network order, compared bit by bit from the MS bit
+ * of the first byte.
+ */
+
+#ifdef ROUTE_IPv6_TRIE
+#  define TRIE_KEYLEN          sizeof(net_ipv6addr_t)
+#else
+#  define TRIE_KEYLEN          sizeof(in_addr_t)
+#endif
+
+#define TRIE_BIT(key, n)       (((key)[(n) >> 3] >> (7 - ((n) & 7))) & 1)
+
+/* Each route adds at most one leaf and one branch node */
+
+#ifdef ROUTE_IPv4_TRIE
+#  define TRIE_IPv4_NODES      (2 * CONFIG_ROUTE_MAX_IPv4_RAMROUTES)
+#else
+#  define TRIE_IPv4_NODES      0
+#endif
+
+#ifdef ROUTE_IPv6_TRIE
+#  define TRIE_IPv6_NODES      (2 * CONFIG_ROUTE_MAX_IPv6_RAMROUTES)
+#else
+#  define TRIE_IPv6_NODES      0
+#endif
+
+#define TRIE_NODES             (TRIE_IPv4_NODES + TRIE_IPv6_NODES)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* A node of the path-compressed binary trie.  The children of a node hold
+ * longer prefixes that start with the prefix of the node, child[n] being
+ * the one whose next bit is n.  Nodes without a route only exist where
+ * two prefixes diverge, so the depth is bounded by the number of distinct
+ * prefix lengths on the path, not by the table size.
+ */
+
+struct route_trie_node_s
+{
+  FAR struct route_trie_node_s *child[2];
+  FAR void *route;              /* Route of this exact prefix, or NULL */
+  uint8_t   key[TRIE_KEYLEN];   /* The prefix, bits beyond plen are 0 */
+  uint8_t   plen;               /* The prefix length in bits */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+NET_BUFPOOL_DECLARE(g_trienodes, sizeof(struct route_trie_node_s),
+                    TRIE_NODES, 0, 0);
+
+#ifdef ROUTE_IPv4_TRIE
+static FAR struct route_trie_node_s *g_ipv4_trie;
+#endif
+
+#ifdef ROUTE_IPv6_TRIE
+static FAR struct route_trie_node_s *g_ipv6_trie;
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: route_trie_prefixcmp
+ *
+ * Description:
+ *   Return true if the first plen bits of the two keys are the same.
+ *
+ ****************************************************************************/
+
+static bool route_trie_prefixcmp(FAR const uint8_t *key1,
+                                 FAR const uint8_t *key2, uint8_t plen)
+{
+  unsigned int nbytes = plen >> 3;
+  uint8_t mask;
+
+  if (memcmp(key1, key2, nbytes) != 0)
+    {
+      return false;
+    }
+
+  if ((plen & 7) == 0)
+    {
+      return true;
+    }
+
+  mask = 0xff << (8 - (plen & 7));
+  return ((key1[nbytes] ^ key2[nbytes]) & mask) == 0;
+}
+
+/****************************************************************************
+ * Name: route_trie_commonlen
+ *
+ * Description:
+ *   Return the number of leading bits that the two keys have in common, at
+ *   most maxlen.
+ *
+ ****************************************************************************/
+
+static uint8_t route_trie_commonlen(FAR const uint8_t *key1,
+                                    FAR const uint8_t *key2, uint8_t maxlen)
+{
+  uint8_t n;
+
+  for (n = 0; n < maxlen && TRIE_BIT(key1, n) == TRIE_BIT(key2, n); n++);
+
+  return n;
+}
+
+/****************************************************************************
+ * Name: route_trie_newnode
+ *
+ * Description:
+ *   Allocate a node for the first plen bits of key.
+ *
+ ****************************************************************************/
+
+static FAR struct route_trie_node_s *
+route_trie_newnode(FAR const uint8_t *key, uint8_t plen, FAR void *route)
+{
+  FAR struct route_trie_node_s *node;
+  unsigned int nbytes = (plen + 7) >> 3;
+
+  node = NET_BUFPOOL_TRYALLOC(g_trienodes);
+  if (node == NULL)
+    {
+      return NULL;
+    }
+
+  memset(node, 0, sizeof(*node));
+  memcpy(node->key, key, nbytes);
+  if ((plen & 7) != 0)
+    {
+      node->key[nbytes - 1] &= 0xff << (8 - (plen & 7));
+    }
+
+  node->plen  = plen;
+  node->route = route;
+  return node;
+}
+
+/****************************************************************************
+ * Name: route_trie_insert
+ *
+ * Description:
+ *   Insert the route for the first plen bits of key.
+ *
+ ****************************************************************************/
+
+static int route_trie_insert(FAR struct route_trie_node_s **root,
+                             FAR const uint8_t *key, uint8_t plen,
+                             FAR void *route)
+{
+  FAR struct route_trie_node_s **pnode = root;
+  FAR struct route_trie_node_s *node;
+  FAR struct route_trie_node_s *leaf;
+  FAR struct route_trie_node_s *branch;
+  uint8_t common;
+
+  /* Descend while the prefix of the node is a prefix of the new one */
+
+  while ((node = *pnode) != NULL &&
+         node->plen <= plen &&
+         route_trie_prefixcmp(node->key, key, node->plen))
+    {
+      if (node->plen == plen)
+        {
+          if (node->route != NULL)
+            {
+              return -EEXIST;
+            }
+
+          /* A branch node becomes the node of the route */
+
+          node->route = route;
+          return OK;
+        }
+
+      pnode = &node->child[TRIE_BIT(key, node->plen)];
+    }
+
+  leaf = route_trie_newnode(key, plen, route);
+  if (leaf == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  if (node == NULL)
+    {
+      *pnode = leaf;
+      return OK;
+    }
+
+  /* The new prefix and the one of the node diverge, or the new one is
+   * shorter.
+   */
+
+  common = route_trie_commonlen(node->key, key, MIN(node->plen, plen));
+  if (common == plen)
+    {
+      /* The new prefix is a prefix of the node, put it above */
+
+      leaf->child[TRIE_BIT(node->key, plen)] = node;
+      *pnode = leaf;
+      return OK;
+    }
+
+  /* Add a branch node where they diverge */
+
+  branch = route_trie_newnode(key, common, NULL);
+  if (branch == NULL)
+    {
+      NET_BUFPOOL_FREE(g_trienodes, leaf);
+      return -ENOMEM;
+    }
+
+  branch->child[TRIE_BIT(key, common)]       = leaf;
+  branch->child[TRIE_BIT(node->key, common)] = node;
+  *pnode = branch;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: route_trie_remove
+ *
+ * Description:
+ *   Remove the route for the first plen bits of key and the nodes that are
+ *   no longer needed.
+ *
+ ****************************************************************************/
+
+static void route_trie_remove(FAR struct route_trie_node_s **root,
+                              FAR const uint8_t *key, uint8_t plen,
+                              FAR void *route)
+{
+  FAR struct route_trie_node_s **pparent = NULL;
+  FAR struct route_trie_node_s **pnode = root;
+  FAR struct route_trie_node_s *parent;
+  FAR struct route_trie_node_s *node;
+
+  while ((node = *pnode) != NULL && node->plen < plen)
+    {
+      pparent = pnode;
+      pnode   = &node->child[TRIE_BIT(key, node->plen)];
+    }
+
+  if (node == NULL || node->plen != plen || node->route != route)
+    {
+      return;
+    }
+
+  node->route = NULL;
+
+  /* A node with two children is still needed as a branch, a node with one
+   * child is replaced by that child.
+   */
+
+  if (node->child[0] != NULL && node->child[1] != NULL)
+    {
+      return;
+    }
+
+  *pnode = node->child[0] != NULL ? node->child[0] : node->child[1];
+  NET_BUFPOOL_FREE(g_trienodes, node);
+
+  /* If a leaf was removed, a parent branch node is left with one child */
+
+  if (*pnode == NULL && pparent != NULL)
+    {
+      parent = *pparent;
+      if (parent->route == NULL)
+        {
+          *pparent = parent->child[0] != NULL ? parent->child[0] :
+                                                parent->child[1];
+          NET_BUFPOOL_FREE(g_trienodes, parent);
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: route_trie_lookup
+ *
+ * Description:
+ *   Return the route with the longest prefix of key that is longer than
+ *   minlen, NULL if there is none.
+ *
+ ****************************************************************************/
+
+static FAR void *route_trie_lookup(FAR struct route_trie_node_s *node,
+                                   FAR const uint8_t *key, uint8_t keybits,
+                                   int minlen)
+{
+  FAR void *route = NULL;
+
+  /* The deeper a matching node, the longer its prefix */
+
+  while (node != NULL && route_trie_prefixcmp(node->key, key, node->plen))
+    {
+      if (node->route != NULL && node->plen > minlen)
+        {
+          route = node->route;
+        }
+
+      if (node->plen >= keybits)
+        {
+          break;
+        }
+
+      node = node->child[TRIE_BIT(key, node->plen)];
+    }
+
+  return route;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: net_trieroute_add_ipv4 and net_trieroute_add_ipv6
+ *
+ * Description:
+ *   Add a routing table entry to the trie.
+ *
+ * Input Parameters:
+ *   route - The entry to add, it must stay valid until it is removed
+ *
+ * Returned Value:
+ *   OK on success; -EINVAL if the netmask is not contiguous; -EEXIST if
+ *   there is already a route for the same prefix; -ENOMEM if no node is
+ *   available.
+ *
+ * Assumptions:
+ *   The routing table is locked.
+ *
+ ****************************************************************************/
+
+#ifdef ROUTE_IPv4_TRIE
+int net_trieroute_add_ipv4(FAR struct net_route_ipv4_s *route)
+{
+  uint32_t hostmask = NTOHL(route->netmask);
+
+  /* The trie only holds prefixes: the inverted mask must be 0..01..1 */
+
+  if ((~hostmask & (~hostmask + 1)) != 0)
+    {
+      nerr("ERROR: Non-contiguous netmask %08" PRIx32 "\n", hostmask);
+      return -EINVAL;
+    }
+
+  return route_trie_insert(&g_ipv4_trie, (FAR const uint8_t *)&route->target,
+                           net_ipv4_mask2pref(route->netmask), route);
+}
+#endif
+
+#ifdef ROUTE_IPv6_TRIE
+int net_trieroute_add_ipv6(FAR struct net_route_ipv6_s *route)
+{
+  net_ipv6addr_t mask;
+  uint8_t plen;
+
+  plen = net_ipv6_mask2pref(route->netmask);
+  net_ipv6_pref2mask(mask, plen);
+  if (!net_ipv6addr_cmp(mask, route->netmask))
+    {
+      nerr("ERROR: Non-contiguous netmask\n");
+      return -EINVAL;
+    }
+
+  return route_trie_insert(&g_ipv6_trie, (FAR const uint8_t *)route->target,
+                           plen, route);
+}
+#endif
+
+/****************************************************************************
+ * Name: net_trieroute_del_ipv4 and net_trieroute_del_ipv6
+ *
+ * Description:
+ *   Remove a routing table entry from the trie.
+ *
+ * Input Parameters:
+ *   route - The entry to remove
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The routing table is locked.
+ *
+ ****************************************************************************/
+
+#ifdef ROUTE_IPv4_TRIE
+void net_trieroute_del_ipv4(FAR struct net_route_ipv4_s *route)
+{
+  route_trie_remove(&g_ipv4_trie, (FAR const uint8_t *)&route->target,
+                    net_ipv4_mask2pref(route->netmask), route);
+}
+#endif
+
+#ifdef ROUTE_IPv6_TRIE
+void net_trieroute_del_ipv6(FAR struct net_route_ipv6_s *route)
+{
+  route_trie_remove(&g_ipv6_trie, (FAR const uint8_t *)route->target,
+                    net_ipv6_mask2pref(route->netmask), route);
+}
+#endif
+
+/****************************************************************************
+ * Name: net_trieroute_ipv4 and net_trieroute_ipv6
+ *
+ * Description:
+ *   Find the route with the longest prefix that matches the target.
+ *
+ * Input Parameters:
+ *   target    - The address to look up
+ *   router    - The location to return the router address
+ *   prefixlen - Only match prefixes longer than this one
+ *
+ * Returned Value:
+ *   OK on success; -ENOENT if there is no matching route.
+ *
+ ****************************************************************************/
+
+#ifdef ROUTE_IPv4_TRIE
+int net_trieroute_ipv4(in_addr_t target, FAR in_addr_t *router,
+                       int8_t prefixlen)
+{
+  FAR struct net_route_ipv4_s *route;
+  int ret = -ENOENT;
+
+  net_lockroute_ipv4();
+
+  route = route_trie_lookup(g_ipv4_trie, (FAR const uint8_t *)&target,
+                            32, prefixlen);
+  if (route != NULL)
+    {
+      net_ipv4addr_copy(*router, route->router);
+      ret = OK;
+    }
+
+  net_unlockroute_ipv4();
+  return ret;
+}
+#endif
+
+#ifdef ROUTE_IPv6_TRIE
+int net_trieroute_ipv6(const net_ipv6addr_t target, net_ipv6addr_t router,
+                       int16_t prefixlen)
+{
+  FAR struct net_route_ipv6_s *route;
+  int ret = -ENOENT;
+
+  net_lockroute_ipv6();
+
+  route = route_trie_lookup(g_ipv6_trie, (FAR const uint8_t *)target,
+                            128, prefixlen);
+  if (route != NULL)
+    {
+      net_ipv6addr_copy(router, route->router);
+      ret = OK;
+    }
+
+  net_unlockroute_ipv6();
+  return ret;
+}
+#endif
+
+#endif /* ROUTE_IPv4_TRIE || ROUTE_IPv6_TRIE */
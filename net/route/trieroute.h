@@ -0,0 +1,137 @@
+/****************************************************************************
+ * net/route/trieroute.h
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __NET_ROUTE_TRIEROUTE_H
+#define __NET_ROUTE_TRIEROUTE_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+
+#include <nuttx/net/ip.h>
+
+#include "route/route.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The trie indexes the in-memory routing tables only */
+
+#if defined(CONFIG_ROUTE_TRIE) && defined(CONFIG_ROUTE_IPv4_RAMROUTE)
+#  define ROUTE_IPv4_TRIE 1
+#endif
+
+#if defined(CONFIG_ROUTE_TRIE) && defined(CONFIG_ROUTE_IPv6_RAMROUTE)
+#  define ROUTE_IPv6_TRIE 1
+#endif
+
+#if defined(ROUTE_IPv4_TRIE) || defined(ROUTE_IPv6_TRIE)
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: net_trieroute_add_ipv4 and net_trieroute_add_ipv6
+ *
+ * Description:
+ *   Add a routing table entry to the trie.
+ *
+ * Input Parameters:
+ *   route - The entry to add, it must stay valid until it is removed
+ *
+ * Returned Value:
+ *   OK on success; -EINVAL if the netmask is not contiguous; -EEXIST if
+ *   there is already a route for the same prefix; -ENOMEM if no node is
+ *   available.
+ *
+ * Assumptions:
+ *   The routing table is locked.
+ *
+ ****************************************************************************/
+
+#ifdef ROUTE_IPv4_TRIE
+int net_trieroute_add_ipv4(FAR struct net_route_ipv4_s *route);
+#endif
+
+#ifdef ROUTE_IPv6_TRIE
+int net_trieroute_add_ipv6(FAR struct net_route_ipv6_s *route);
+#endif
+
+/****************************************************************************
+ * Name: net_trieroute_del_ipv4 and net_trieroute_del_ipv6
+ *
+ * Description:
+ *   Remove a routing table entry from the trie.
+ *
+ * Input Parameters:
+ *   route - The entry to remove
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The routing table is locked.
+ *
+ ****************************************************************************/
+
+#ifdef ROUTE_IPv4_TRIE
+void net_trieroute_del_ipv4(FAR struct net_route_ipv4_s *route);
+#endif
+
+#ifdef ROUTE_IPv6_TRIE
+void net_trieroute_del_ipv6(FAR struct net_route_ipv6_s *route);
+#endif
+
+/****************************************************************************
+ * Name: net_trieroute_ipv4 and net_trieroute_ipv6
+ *
+ * Description:
+ *   Find the route with the longest prefix that matches the target.
+ *
+ * Input Parameters:
+ *   target    - The address to look up
+ *   router    - The location to return the router address
+ *   prefixlen - Only match prefixes longer than this one
+ *
+ * Returned Value:
+ *   OK on success; -ENOENT if there is no matching route.
+ *
+ ****************************************************************************/
+
+#ifdef ROUTE_IPv4_TRIE
+int net_trieroute_ipv4(in_addr_t target, FAR in_addr_t *router,
+                       int8_t prefixlen);
+#endif
+
+#ifdef ROUTE_IPv6_TRIE
+int net_trieroute_ipv6(const net_ipv6addr_t target, net_ipv6addr_t router,
+                       int16_t prefixlen);
+#endif
+
+#endif /* ROUTE_IPv4_TRIE || ROUTE_IPv6_TRIE */
+#endif /* __NET_ROUTE_TRIEROUTE_H */
@@ -81,6 +81,15 @@ ssize_t psock_recvfrom(FAR struct socket *psock, FAR void *buf, size_t len,
   struct iovec iov;
   ssize_t ret;
 
+  /* MSG_ZCRECV lends the buffers through msg_iov[], which only
+   * recvmsg() returns to the caller.
+   */
+
+  if ((flags & MSG_ZCRECV) != 0)
+    {
+      return -EINVAL;
+    }
+
   iov.iov_base = buf;
   iov.iov_len = len;
   msg.msg_name = from;
@@ -83,6 +83,8 @@ ssize_t psock_recvmsg(FAR struct socket *psock, FAR struct msghdr *msg,
       return -EINVAL;
     }
 
+  msg->msg_flags &= ~MSG_ZCRECV;
+
   if (msg->msg_name != NULL && msg->msg_namelen <= 0)
     {
       return -EINVAL;
@@ -105,6 +105,7 @@
 #define TCP_WSCALE            0x01U /* Window Scale option enabled */
 #define TCP_SACK              0x02U /* Selective ACKs enabled */
 #define TCP_CLOSE_ARRANGED    0x04U /* Connection is arranged to be freed */
+#define TCP_TSOPT             0x20U /* Timestamps option enabled */
 
 #ifdef CONFIG_NET_TCP_CC_NEWRENO
 /* The TCP flags for congestion control */
@@ -112,12 +113,37 @@
 #define TCP_INFR              0x08U /* The flag in Fast Recovery */
 #define TCP_INFT              0x10U /* The flag in Fast Transmitted */
 
+/* The maximum length of a congestion control algorithm name, including the
+ * terminating NUL (TCP_CONGESTION socket option).
+ */
+
+#define TCP_CC_NAME_MAX       16
+
 #endif
 
 /* The Max Range count of TCP Selective ACKs */
 
 #define TCP_SACK_RANGES_MAX   4
 
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+/* Once negotiated, the Timestamps option is carried by every segment,
+ * preceded by two NOPs to keep the following data aligned.  It leaves room
+ * for 3 SACK blocks in the option space.
+ */
+
+#  define TCP_OPT_TS_ALIGNED_LEN  12
+#  define TCP_SACK_RANGES_TS      3
+
+/* TS.Recent is no longer valid after 24 days of idle (RFC 7323, 5.5) */
+
+#  define TCP_PAWS_IDLE           (24U * 24 * 60 * 60 * 1000)
+
+#  define tcp_optlen(conn) \
+     (((conn)->flags & TCP_TSOPT) != 0 ? TCP_OPT_TS_ALIGNED_LEN : 0)
+#else
+#  define tcp_optlen(conn) 0
+#endif
+
 /* After receiving 3 duplicate ACKs, TCP performs a retransmission
  * (RFC 5681 (3.2))
  */
@@ -149,6 +175,69 @@ struct net_driver_s;      /* Forward reference */
 struct devif_callback_s;  /* Forward reference */
 struct tcp_backlog_s;     /* Forward reference */
 struct tcp_hdr_s;         /* Forward reference */
+struct tcp_conn_s;        /* Forward reference */
+
+#ifdef CONFIG_NET_TCP_CC_NEWRENO
+/* A congestion control algorithm.  The RFC 5681 machinery (duplicate ACK
+ * counting, fast retransmit and fast recovery, retransmission timeout) is
+ * common to all algorithms in tcp_cc.c; the algorithm only decides how
+ * cwnd grows and how far it is reduced on loss.
+ */
+
+struct tcp_cc_ops_s
+{
+  FAR const char *name;
+
+  /* Initialize the private state, called when cwnd is (re)initialized */
+
+  CODE void (*init)(FAR struct tcp_conn_s *conn);
+
+  /* Return the new ssthresh on loss, detected by fast retransmit or by
+   * the retransmission timeout.
+   */
+
+  CODE uint32_t (*ssthresh)(FAR struct tcp_conn_s *conn);
+
+  /* Grow cwnd when 'acked' bytes of new data were acknowledged by 'ackno'
+   * outside of fast recovery.
+   */
+
+  CODE void (*cong_avoid)(FAR struct tcp_conn_s *conn, uint32_t ackno,
+                          uint32_t acked);
+};
+
+#ifdef CONFIG_NET_TCP_CC_CUBIC
+/* CUBIC (RFC 8312) private state */
+
+struct tcp_cc_cubic_s
+{
+  uint32_t epoch_start;   /* Start of the congestion avoidance epoch (ms),
+                           * 0 if none */
+  uint32_t k;             /* Time to reach w_max from the epoch start (ms) */
+  uint32_t w_max;         /* cwnd before the last reduction (bytes) */
+  uint32_t origin;        /* Origin point of the cubic function (bytes) */
+  uint32_t w_est;         /* Reno-friendly window estimate (bytes) */
+};
+#endif
+
+#ifdef CONFIG_NET_TCP_CC_BBR
+/* Rate/RTT based (BBR-style) private state */
+
+struct tcp_cc_bbr_s
+{
+  uint32_t round_end;     /* Sequence number that ends the round */
+  uint32_t round_start;   /* Start time of the round (ms) */
+  uint32_t delivered;     /* Bytes acknowledged in the round */
+  uint32_t max_bw;        /* Windowed maximum delivery rate (bytes/s) */
+  uint32_t full_bw;       /* Delivery rate at the last startup growth */
+  uint32_t min_rtt;       /* Windowed minimum round trip time (ms) */
+  uint32_t min_rtt_stamp; /* Time the min_rtt was measured (ms) */
+  uint8_t  bw_age;        /* Rounds since max_bw was measured */
+  uint8_t  full_bw_cnt;   /* Rounds without startup growth */
+  bool     startup;       /* Still probing for the bottleneck rate */
+};
+#endif
+#endif /* CONFIG_NET_TCP_CC_NEWRENO */
 
 /* This is a container that holds the poll-related information */
 
@@ -209,6 +298,10 @@ struct tcp_conn_s
   /* TCP-specific content follows */
 
   union ip_binding_u u;   /* IP address binding */
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  dq_entry_t hnode;       /* Link in the active connection hash bucket */
+  dq_entry_t lnode;       /* Link in the listener hash bucket */
+#endif
   uint8_t  rcvseq[4];     /* The sequence number that we expect to
                            * receive next */
   uint8_t  sndseq[4];     /* The sequence number that was last sent by us */
@@ -243,6 +336,12 @@ struct tcp_conn_s
                            * connection */
 #endif
   uint32_t rcv_adv;       /* The right edge of the recv window advertised */
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+  uint32_t ts_recent;     /* The timestamp to echo to the peer (TS.Recent) */
+  uint32_t ts_recent_age; /* The time ts_recent was updated (ms) */
+  uint32_t srtt;          /* The smoothed round trip time (ms << 3) */
+  uint32_t rttvar;        /* The round trip time variation (ms << 2) */
+#endif
 #ifdef CONFIG_NET_TCP_CC_NEWRENO
   uint32_t last_ackno;    /* The ack number at the last receive ack */
   uint32_t dupacks;       /* The number of duplicate ack */
@@ -251,6 +350,21 @@ struct tcp_conn_s
   uint32_t cwnd;          /* The Congestion window */
   uint32_t max_cwnd;      /* The Congestion window maximum value */
   uint32_t ssthresh;      /* The Slow start threshold */
+
+  /* The congestion control algorithm and its private state */
+
+  FAR const struct tcp_cc_ops_s *cc_ops;
+#if defined(CONFIG_NET_TCP_CC_CUBIC) || defined(CONFIG_NET_TCP_CC_BBR)
+  union
+  {
+#  ifdef CONFIG_NET_TCP_CC_CUBIC
+    struct tcp_cc_cubic_s cubic;
+#  endif
+#  ifdef CONFIG_NET_TCP_CC_BBR
+    struct tcp_cc_bbr_s   bbr;
+#  endif
+  } cc;
+#endif
 #endif
 #ifdef CONFIG_NET_TCP_WINDOW_SCALE
   uint32_t snd_wnd;       /* Sequence and acknowledgement numbers of last
@@ -1158,6 +1272,39 @@ bool tcp_islistener(FAR union ip_binding_u *uaddr, uint16_t portno,
 bool tcp_islistener(FAR union ip_binding_u *uaddr, uint16_t portno);
 #endif
 
+/****************************************************************************
+ * Name: tcp_listener_reusable
+ *
+ * Description:
+ *   Return true if all the listeners on this local address and port set
+ *   SO_REUSEPORT.
+ *
+ * Assumptions:
+ *   Called from network stack logic with the network stack locked
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_REUSEPORT
+bool tcp_listener_reusable(uint8_t domain, FAR const union ip_addr_u *ipaddr,
+                           uint16_t portno);
+
+/****************************************************************************
+ * Name: tcp_reuseport_select
+ *
+ * Description:
+ *   Pick the listener of the SO_REUSEPORT group of listener that handles
+ *   the flow from the remote address in uaddr and port rport.
+ *
+ * Assumptions:
+ *   Called from network stack logic with the network stack locked
+ *
+ ****************************************************************************/
+
+FAR struct tcp_conn_s *
+tcp_reuseport_select(FAR struct tcp_conn_s *listener,
+                     FAR const union ip_binding_u *uaddr, uint16_t rport);
+#endif
+
 /****************************************************************************
  * Name: tcp_accept_connection
  *
@@ -2243,7 +2390,8 @@ void tcp_sendbuffer_notify(FAR struct tcp_conn_s *conn);
  * Name: tcpip_hdrsize
  *
  * Description:
- *   Get the total size of L3 and L4 TCP header
+ *   Get the total size of L3 and L4 TCP header, including the options that
+ *   are carried by every segment of the connection.
  *
  * Input Parameters:
  *   conn     The connection structure associated with the socket
@@ -2356,6 +2504,66 @@ void tcp_cc_update(FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp);
  ****************************************************************************/
 
 void tcp_cc_recv_ack(FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp);
+
+/****************************************************************************
+ * Name: tcp_cc_timeout
+ *
+ * Description:
+ *   Update the congestion control variables after a retransmission
+ *   timeout: leave fast recovery and restart from slow start.
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection of interest
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+void tcp_cc_timeout(FAR struct tcp_conn_s *conn);
+
+/****************************************************************************
+ * Name: tcp_cc_select/tcp_cc_name
+ *
+ * Description:
+ *   Select the congestion control algorithm of a connection by name, or
+ *   return the name of the current one (TCP_CONGESTION socket option).
+ *   A NULL name selects the default algorithm.
+ *
+ * Returned Value:
+ *   tcp_cc_select() returns zero (OK) on success or -ENOENT if no such
+ *   algorithm is configured.
+ *
+ ****************************************************************************/
+
+int tcp_cc_select(FAR struct tcp_conn_s *conn, FAR const char *name);
+FAR const char *tcp_cc_name(FAR struct tcp_conn_s *conn);
+
+/****************************************************************************
+ * Name: tcp_cc_slow_start/tcp_cc_cwnd_inc
+ *
+ * Description:
+ *   Helpers for the congestion control algorithms: Grow cwnd by at most
+ *   one MSS per ACK (RFC 5681 slow start), or by 'inc' bytes, saturating
+ *   instead of wrapping around.
+ *
+ ****************************************************************************/
+
+void tcp_cc_slow_start(FAR struct tcp_conn_s *conn, uint32_t acked);
+void tcp_cc_cwnd_inc(FAR struct tcp_conn_s *conn, uint32_t inc);
+
+/* The congestion control algorithms */
+
+extern const struct tcp_cc_ops_s g_tcp_cc_newreno;
+#ifdef CONFIG_NET_TCP_CC_CUBIC
+extern const struct tcp_cc_ops_s g_tcp_cc_cubic;
+#endif
+#ifdef CONFIG_NET_TCP_CC_BBR
+extern const struct tcp_cc_ops_s g_tcp_cc_bbr;
+#endif
 #endif
 
 #ifdef __cplusplus
@@ -0,0 +1,208 @@
+/****************************************************************************
+ * net/tcp/tcp_cc_bbr.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/debug.h>
+
+#include "tcp/tcp.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define BBR_RTT_WINDOW     10000  /* Window of the min_rtt filter (ms) */
+#define BBR_BW_WINDOW      10     /* Window of the max_bw filter (rounds) */
+#define BBR_FULL_BW_ROUNDS 3      /* Rounds without 25% growth to leave
+                                   * startup */
+#define BBR_CWND_GAIN      2      /* cwnd in units of the estimated BDP */
+#define BBR_MIN_CWND       4      /* Minimum cwnd (segments) */
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static void tcp_bbr_init(FAR struct tcp_conn_s *conn);
+static uint32_t tcp_bbr_ssthresh(FAR struct tcp_conn_s *conn);
+static void tcp_bbr_cong_avoid(FAR struct tcp_conn_s *conn,
+                               uint32_t ackno, uint32_t acked);
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+const struct tcp_cc_ops_s g_tcp_cc_bbr =
+{
+  "bbr",                    /* name */
+  tcp_bbr_init,             /* init */
+  tcp_bbr_ssthresh,         /* ssthresh */
+  tcp_bbr_cong_avoid,       /* cong_avoid */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: tcp_bbr_start_round
+ *
+ * Description:
+ *   Start a new round: it ends when everything sent so far is ACKed.
+ *
+ ****************************************************************************/
+
+static void tcp_bbr_start_round(FAR struct tcp_conn_s *conn, uint32_t now)
+{
+  FAR struct tcp_cc_bbr_s *bbr = &conn->cc.bbr;
+
+  bbr->round_end   = tcp_getsequence(conn->sndseq);
+  bbr->round_start = now;
+  bbr->delivered   = 0;
+}
+
+/****************************************************************************
+ * Name: tcp_bbr_end_round
+ *
+ * Description:
+ *   Take the delivery rate and round trip time samples of a round, and
+ *   update the windowed max_bw and min_rtt filters.
+ *
+ ****************************************************************************/
+
+static void tcp_bbr_end_round(FAR struct tcp_conn_s *conn, uint32_t now)
+{
+  FAR struct tcp_cc_bbr_s *bbr = &conn->cc.bbr;
+  uint32_t elapsed = MAX(now - bbr->round_start, 1);
+  uint32_t bw = MIN((uint64_t)bbr->delivered * 1000 / elapsed, UINT32_MAX);
+
+  if (bw >= bbr->max_bw || ++bbr->bw_age >= BBR_BW_WINDOW)
+    {
+      bbr->max_bw = bw;
+      bbr->bw_age = 0;
+    }
+
+  if (elapsed <= bbr->min_rtt ||
+      now - bbr->min_rtt_stamp > BBR_RTT_WINDOW)
+    {
+      bbr->min_rtt       = elapsed;
+      bbr->min_rtt_stamp = now;
+    }
+
+  /* Leave startup once the delivery rate stops growing by 25% per round,
+   * the bottleneck is then full.
+   */
+
+  if (bbr->startup)
+    {
+      if (bbr->max_bw >= (uint64_t)bbr->full_bw * 5 / 4)
+        {
+          bbr->full_bw     = bbr->max_bw;
+          bbr->full_bw_cnt = 0;
+        }
+      else if (++bbr->full_bw_cnt >= BBR_FULL_BW_ROUNDS)
+        {
+          bbr->startup = false;
+          ninfo("bbr: bw=%u rtt=%u, leave startup\n",
+                bbr->max_bw, bbr->min_rtt);
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: tcp_bbr_init
+ ****************************************************************************/
+
+static void tcp_bbr_init(FAR struct tcp_conn_s *conn)
+{
+  FAR struct tcp_cc_bbr_s *bbr = &conn->cc.bbr;
+
+  memset(bbr, 0, sizeof(*bbr));
+  bbr->min_rtt = UINT32_MAX;
+  bbr->startup = true;
+}
+
+/****************************************************************************
+ * Name: tcp_bbr_ssthresh
+ *
+ * Description:
+ *   Loss is not taken as a congestion signal: keep the window, which the
+ *   model bounds by the estimated bandwidth-delay product anyway.
+ *
+ ****************************************************************************/
+
+static uint32_t tcp_bbr_ssthresh(FAR struct tcp_conn_s *conn)
+{
+  return MAX(conn->cwnd, 2 * conn->mss);
+}
+
+/****************************************************************************
+ * Name: tcp_bbr_cong_avoid
+ *
+ * Description:
+ *   Update the model once per round, and hold cwnd at BBR_CWND_GAIN times
+ *   the estimated bandwidth-delay product.  During startup cwnd doubles
+ *   each round, as in slow start.
+ *
+ ****************************************************************************/
+
+static void tcp_bbr_cong_avoid(FAR struct tcp_conn_s *conn,
+                               uint32_t ackno, uint32_t acked)
+{
+  FAR struct tcp_cc_bbr_s *bbr = &conn->cc.bbr;
+  uint32_t now = TICK2MSEC(clock_systime_ticks());
+  uint64_t target;
+
+  bbr->delivered += acked;
+
+  if (bbr->round_start == 0)
+    {
+      tcp_bbr_start_round(conn, now);
+    }
+  else if (TCP_SEQ_GTE(ackno, bbr->round_end))
+    {
+      tcp_bbr_end_round(conn, now);
+      tcp_bbr_start_round(conn, now);
+    }
+
+  if (bbr->startup || bbr->max_bw == 0)
+    {
+      tcp_cc_cwnd_inc(conn, acked);
+    }
+  else
+    {
+      target = (uint64_t)bbr->max_bw * bbr->min_rtt / 1000 * BBR_CWND_GAIN;
+      target = MAX(target, BBR_MIN_CWND * conn->mss);
+
+      tcp_cc_cwnd_inc(conn, acked);
+      conn->cwnd = MIN(conn->cwnd, target);
+    }
+
+  ninfo("update bbr cwnd to %u\n", conn->cwnd);
+}
@@ -0,0 +1,259 @@
+/****************************************************************************
+ * net/tcp/tcp_cc_cubic.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/debug.h>
+
+#include "tcp/tcp.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Multiplicative decrease factor beta_cubic = 0.7, scaled by 1024 */
+
+#define CUBIC_BETA        717
+#define CUBIC_SCALE       1024
+
+/* Reno-friendly additive increase 3 * (1 - beta) / (1 + beta), scaled by
+ * 1024.
+ */
+
+#define CUBIC_ALPHA       542
+
+/* C = 0.4 segments/s^3.  With the time in milliseconds:
+ *   W(t) = C * (t - K)^3 + W_max = 4 * (t - K)^3 / 10^10 segments
+ *   K^3 = (W_max - cwnd) / C = 2.5 * 10^9 * (W_max - cwnd) ms^3
+ */
+
+#define CUBIC_K3_PER_SEG  2500000000ull
+
+/* Limit of the time since the epoch start, so that the cube fits in 63
+ * bits.
+ */
+
+#define CUBIC_MAX_T       1000000
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static void tcp_cubic_init(FAR struct tcp_conn_s *conn);
+static uint32_t tcp_cubic_ssthresh(FAR struct tcp_conn_s *conn);
+static void tcp_cubic_cong_avoid(FAR struct tcp_conn_s *conn,
+                                 uint32_t ackno, uint32_t acked);
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+const struct tcp_cc_ops_s g_tcp_cc_cubic =
+{
+  "cubic",                  /* name */
+  tcp_cubic_init,           /* init */
+  tcp_cubic_ssthresh,       /* ssthresh */
+  tcp_cubic_cong_avoid,     /* cong_avoid */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: tcp_cubic_now
+ *
+ * Description:
+ *   Return the current time in milliseconds, never zero which marks "no
+ *   epoch".
+ *
+ ****************************************************************************/
+
+static uint32_t tcp_cubic_now(void)
+{
+  uint32_t now = TICK2MSEC(clock_systime_ticks());
+
+  return now != 0 ? now : 1;
+}
+
+/****************************************************************************
+ * Name: tcp_cubic_cbrt
+ *
+ * Description:
+ *   Integer cube root, rounded down.
+ *
+ ****************************************************************************/
+
+static uint32_t tcp_cubic_cbrt(uint64_t x)
+{
+  uint32_t lo = 0;
+  uint32_t hi = 2097151; /* cbrt(2^63) */
+
+  while (lo < hi)
+    {
+      uint64_t mid = (lo + hi + 1) / 2;
+
+      if (mid * mid * mid <= x)
+        {
+          lo = mid;
+        }
+      else
+        {
+          hi = mid - 1;
+        }
+    }
+
+  return lo;
+}
+
+/****************************************************************************
+ * Name: tcp_cubic_init
+ ****************************************************************************/
+
+static void tcp_cubic_init(FAR struct tcp_conn_s *conn)
+{
+  memset(&conn->cc.cubic, 0, sizeof(conn->cc.cubic));
+}
+
+/****************************************************************************
+ * Name: tcp_cubic_ssthresh
+ *
+ * Description:
+ *   Remember the window at the loss (with fast convergence, RFC8312
+ *   Section 4.6) and reduce it by beta_cubic.
+ *
+ ****************************************************************************/
+
+static uint32_t tcp_cubic_ssthresh(FAR struct tcp_conn_s *conn)
+{
+  FAR struct tcp_cc_cubic_s *cubic = &conn->cc.cubic;
+  uint32_t cwnd = conn->cwnd;
+
+  cubic->epoch_start = 0;
+
+  /* Release bandwidth to new flows if the window keeps shrinking */
+
+  if (cwnd < cubic->w_max)
+    {
+      cubic->w_max = (uint64_t)cwnd * (CUBIC_SCALE + CUBIC_BETA) /
+                     (2 * CUBIC_SCALE);
+    }
+  else
+    {
+      cubic->w_max = cwnd;
+    }
+
+  return MAX((uint64_t)cwnd * CUBIC_BETA / CUBIC_SCALE, 2 * conn->mss);
+}
+
+/****************************************************************************
+ * Name: tcp_cubic_cong_avoid
+ *
+ * Description:
+ *   Grow cwnd towards the cubic function W(t) (RFC8312 Section 4.1), or
+ *   towards the Reno-friendly estimate if that is larger (Section 4.2).
+ *
+ ****************************************************************************/
+
+static void tcp_cubic_cong_avoid(FAR struct tcp_conn_s *conn,
+                                 uint32_t ackno, uint32_t acked)
+{
+  FAR struct tcp_cc_cubic_s *cubic = &conn->cc.cubic;
+  uint32_t cwnd = conn->cwnd;
+  uint32_t now;
+  uint32_t t;
+  int64_t target;
+  int64_t d;
+  uint64_t inc;
+
+  if (cwnd < conn->ssthresh)
+    {
+      tcp_cc_slow_start(conn, acked);
+      return;
+    }
+
+  now = tcp_cubic_now();
+  if (cubic->epoch_start == 0)
+    {
+      /* Start a new congestion avoidance epoch */
+
+      cubic->epoch_start = now;
+      cubic->w_est       = cwnd;
+
+      if (cwnd < cubic->w_max)
+        {
+          cubic->k      = tcp_cubic_cbrt((uint64_t)(cubic->w_max - cwnd) /
+                                         conn->mss * CUBIC_K3_PER_SEG);
+          cubic->origin = cubic->w_max;
+        }
+      else
+        {
+          cubic->k      = 0;
+          cubic->origin = cwnd;
+        }
+    }
+
+  t = MIN(now - cubic->epoch_start, CUBIC_MAX_T);
+  d = (int64_t)t - cubic->k;
+
+  /* W(t) in bytes, the cube is first scaled down to avoid overflow */
+
+  target = cubic->origin +
+           d * d * d / 1000000 * 4 * conn->mss / 10000;
+
+  /* Reno-friendly region */
+
+  cubic->w_est += (uint64_t)acked * CUBIC_ALPHA * conn->mss /
+                  CUBIC_SCALE / cwnd;
+  if (cubic->w_est > target)
+    {
+      target = cubic->w_est;
+    }
+
+  /* Never more than 1.5 * cwnd per RTT */
+
+  target = MIN(target, (int64_t)cwnd + cwnd / 2);
+
+  if (target > cwnd)
+    {
+      inc = (uint64_t)(target - cwnd) * acked / cwnd;
+    }
+  else
+    {
+      inc = (uint64_t)acked * conn->mss / (100 * (uint64_t)cwnd);
+    }
+
+  if (inc > 0)
+    {
+      tcp_cc_cwnd_inc(conn, MIN(inc, UINT32_MAX));
+    }
+
+  ninfo("update cubic cwnd to %u\n", conn->cwnd);
+}
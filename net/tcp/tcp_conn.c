@@ -58,6 +58,7 @@
 
 #include <nuttx/clock.h>
 #include <nuttx/kmalloc.h>
+#include <nuttx/nuttx.h>
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/net.h>
 #include <nuttx/net/netdev.h>
@@ -71,6 +72,7 @@
 #include "icmpv6/icmpv6.h"
 #include "nat/nat.h"
 #include "netdev/netdev.h"
+#include "socket/socket.h"
 #include "utils/utils.h"
 
 /****************************************************************************
@@ -81,6 +83,14 @@
 #  define CONFIG_NET_TCP_MAX_CONNS 0
 #endif
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+#  if (CONFIG_NET_TCP_CONN_HASHSIZE & (CONFIG_NET_TCP_CONN_HASHSIZE - 1)) != 0
+#    error CONFIG_NET_TCP_CONN_HASHSIZE must be a power of two
+#  endif
+
+#  define TCP_CONN_HASHMASK (CONFIG_NET_TCP_CONN_HASHSIZE - 1)
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -95,10 +105,123 @@ NET_BUFPOOL_DECLARE(g_tcp_connections, sizeof(struct tcp_conn_s),
 
 static dq_queue_t g_active_tcp_connections;
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+/* The active connections indexed by local port, remote port and remote
+ * address.  Each connection in g_active_tcp_connections is also linked
+ * into exactly one bucket of this table through its hnode.
+ */
+
+static dq_queue_t g_tcp_conn_hash[CONFIG_NET_TCP_CONN_HASHSIZE];
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+/****************************************************************************
+ * Name: tcp_hash
+ *
+ * Description:
+ *   Map the local port, remote port (both in network byte order) and the
+ *   (folded) remote address of a connection to a hash bucket index.
+ *
+ ****************************************************************************/
+
+static inline unsigned int tcp_hash(uint16_t lport, uint16_t rport,
+                                    uint32_t raddr)
+{
+  uint32_t key = raddr ^ ((uint32_t)lport << 16 | rport);
+
+  key ^= key >> 16;
+  key *= 0x45d9f3b;
+  key ^= key >> 16;
+
+  return key & TCP_CONN_HASHMASK;
+}
+
+/****************************************************************************
+ * Name: tcp_ipv6_hashaddr
+ *
+ * Description:
+ *   Fold an IPv6 address into 32 bits for use with tcp_hash().
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPv6
+static inline uint32_t tcp_ipv6_hashaddr(FAR const uint16_t *addr)
+{
+  return ((uint32_t)addr[0] << 16 | addr[1]) ^
+         ((uint32_t)addr[2] << 16 | addr[3]) ^
+         ((uint32_t)addr[4] << 16 | addr[5]) ^
+         ((uint32_t)addr[6] << 16 | addr[7]);
+}
+#endif
+
+/****************************************************************************
+ * Name: tcp_conn_hash
+ *
+ * Description:
+ *   Return the hash bucket index of an active connection.
+ *
+ ****************************************************************************/
+
+static unsigned int tcp_conn_hash(FAR struct tcp_conn_s *conn)
+{
+#ifdef CONFIG_NET_IPv6
+#ifdef CONFIG_NET_IPv4
+  if (conn->domain == PF_INET6)
+#endif
+    {
+      return tcp_hash(conn->lport, conn->rport,
+                      tcp_ipv6_hashaddr(conn->u.ipv6.raddr));
+    }
+#endif /* CONFIG_NET_IPv6 */
+
+#ifdef CONFIG_NET_IPv4
+#ifdef CONFIG_NET_IPv6
+  else
+#endif
+    {
+      return tcp_hash(conn->lport, conn->rport, conn->u.ipv4.raddr);
+    }
+#endif /* CONFIG_NET_IPv4 */
+}
+
+/****************************************************************************
+ * Name: tcp_hash_entry
+ *
+ * Description:
+ *   Return the connection that contains the hash bucket link 'node'.
+ *
+ ****************************************************************************/
+
+static inline FAR struct tcp_conn_s *tcp_hash_entry(FAR dq_entry_t *node)
+{
+  return node != NULL ? container_of(node, struct tcp_conn_s, hnode) : NULL;
+}
+#endif /* CONFIG_NET_TCP_CONN_HASH */
+
+/****************************************************************************
+ * Name: tcp_addconn
+ *
+ * Description:
+ *   Add the connection to the list of active TCP connections (and to the
+ *   connection hash table, if enabled).
+ *
+ * Assumptions:
+ *   This function is called with the tcp conn list locked.
+ *
+ ****************************************************************************/
+
+static void tcp_addconn(FAR struct tcp_conn_s *conn)
+{
+  dq_addlast(&conn->sconn.node, &g_active_tcp_connections);
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  dq_addlast(&conn->hnode, &g_tcp_conn_hash[tcp_conn_hash(conn)]);
+#endif
+}
+
 /****************************************************************************
  * Name: tcp_listener
  *
@@ -150,6 +273,50 @@ static FAR struct tcp_conn_s *
 #endif
 }
 
+/****************************************************************************
+ * Name: tcp_reuseport_bindable
+ *
+ * Description:
+ *   Return true if a connection setting SO_REUSEPORT may bind to a local
+ *   address and port (in network byte order) already in use: all the
+ *   connections and listeners using it must set SO_REUSEPORT too.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_REUSEPORT
+static bool tcp_reuseport_bindable(uint8_t domain,
+                                   FAR const union ip_addr_u *ipaddr,
+                                   uint16_t portno)
+{
+  FAR struct tcp_conn_s *conn = NULL;
+  bool reusable = true;
+
+  tcp_conn_list_lock();
+  while (reusable && (conn = tcp_nextconn(conn)) != NULL)
+    {
+      if (conn->tcpstateflags != TCP_CLOSED &&
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+          tcp_conn_cmp(domain, ipaddr, portno, conn)
+#else
+          tcp_conn_cmp(ipaddr, portno, conn)
+#endif
+         )
+        {
+          reusable = _SO_GETOPT(conn->sconn.s_options, SO_REUSEPORT);
+        }
+    }
+
+  reusable = reusable && tcp_listener_reusable(domain, ipaddr, portno)
+#ifdef CONFIG_NET_NAT
+             && !nat_port_inuse(domain, IP_PROTO_TCP, ipaddr, portno)
+#endif
+             ;
+
+  tcp_conn_list_unlock();
+  return reusable;
+}
+#endif
+
 /****************************************************************************
  * Name: tcp_ipv4_active
  *
@@ -170,10 +337,18 @@ static inline FAR struct tcp_conn_s *
   FAR struct tcp_conn_s *conn;
   in_addr_t srcipaddr;
   in_addr_t destipaddr;
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  unsigned int hash;
+#endif
 
-  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
   srcipaddr  = net_ip4addr_conv32(ip->srcipaddr);
   destipaddr = net_ip4addr_conv32(ip->destipaddr);
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  hash       = tcp_hash(tcp->destport, tcp->srcport, srcipaddr);
+  conn       = tcp_hash_entry(dq_peek(&g_tcp_conn_hash[hash]));
+#else
+  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
+#endif
 
   while (conn)
     {
@@ -210,7 +385,11 @@ static inline FAR struct tcp_conn_s *
 
       /* Look at the next active connection */
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+      conn = tcp_hash_entry(conn->hnode.flink);
+#else
       conn = (FAR struct tcp_conn_s *)conn->sconn.node.flink;
+#endif
     }
 
   return conn;
@@ -237,10 +416,19 @@ static inline FAR struct tcp_conn_s *
   FAR struct tcp_conn_s *conn;
   net_ipv6addr_t *srcipaddr;
   net_ipv6addr_t *destipaddr;
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  unsigned int hash;
+#endif
 
-  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
   srcipaddr  = (net_ipv6addr_t *)ip->srcipaddr;
   destipaddr = (net_ipv6addr_t *)ip->destipaddr;
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  hash       = tcp_hash(tcp->destport, tcp->srcport,
+                        tcp_ipv6_hashaddr(*srcipaddr));
+  conn       = tcp_hash_entry(dq_peek(&g_tcp_conn_hash[hash]));
+#else
+  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
+#endif
 
   while (conn)
     {
@@ -277,7 +465,11 @@ static inline FAR struct tcp_conn_s *
 
       /* Look at the next active connection */
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+      conn = tcp_hash_entry(conn->hnode.flink);
+#else
       conn = (FAR struct tcp_conn_s *)conn->sconn.node.flink;
+#endif
     }
 
   return conn;
@@ -344,6 +536,19 @@ static inline int tcp_ipv4_bind(FAR struct tcp_conn_s *conn,
   port = tcp_selectport(PF_INET,
                        (FAR const union ip_addr_u *)&addr->sin_addr.s_addr,
                        addr->sin_port);
+#ifdef CONFIG_NET_REUSEPORT
+  if (port == -EADDRINUSE && addr->sin_port != 0 &&
+      _SO_GETOPT(conn->sconn.s_options, SO_REUSEPORT) &&
+      tcp_reuseport_bindable(PF_INET,
+                       (FAR const union ip_addr_u *)&addr->sin_addr.s_addr,
+                       addr->sin_port))
+    {
+      /* Share the port with the other SO_REUSEPORT sockets */
+
+      port = addr->sin_port;
+    }
+#endif
+
   if (port < 0)
     {
       nerr("ERROR: tcp_selectport failed: %d\n", port);
@@ -440,6 +645,19 @@ static inline int tcp_ipv6_bind(FAR struct tcp_conn_s *conn,
   port = tcp_selectport(PF_INET6,
                 (FAR const union ip_addr_u *)addr->sin6_addr.in6_u.u6_addr16,
                 addr->sin6_port);
+#ifdef CONFIG_NET_REUSEPORT
+  if (port == -EADDRINUSE && addr->sin6_port != 0 &&
+      _SO_GETOPT(conn->sconn.s_options, SO_REUSEPORT) &&
+      tcp_reuseport_bindable(PF_INET6,
+                (FAR const union ip_addr_u *)addr->sin6_addr.in6_u.u6_addr16,
+                addr->sin6_port))
+    {
+      /* Share the port with the other SO_REUSEPORT sockets */
+
+      port = addr->sin6_port;
+    }
+#endif
+
   if (port < 0)
     {
       nerr("ERROR: tcp_selectport failed: %d\n", port);
@@ -812,7 +1030,7 @@ void tcp_free(FAR struct tcp_conn_s *conn)
       /* Remove the connection from the active list */
 
       tcp_conn_list_lock();
-      dq_rem(&conn->sconn.node, &g_active_tcp_connections);
+      tcp_removeconn(conn);
       tcp_conn_list_unlock();
     }
 
@@ -1121,6 +1339,9 @@ FAR struct tcp_conn_s *tcp_alloc_accept(FAR struct net_driver_s *dev,
 #  ifdef CONFIG_NET_BINDTODEVICE
       conn->sconn.s_boundto  = listener->sconn.s_boundto;
 #  endif
+#  ifdef CONFIG_NET_REUSEPORT
+      conn->sconn.s_options |= listener->sconn.s_options & _SO_REUSEPORT;
+#  endif
 #endif
 
       conn->sconn.s_tos      = listener->sconn.s_tos;
@@ -1157,6 +1378,7 @@ FAR struct tcp_conn_s *tcp_alloc_accept(FAR struct net_driver_s *dev,
 #ifdef CONFIG_NET_TCP_CC_NEWRENO
       /* Initialize the variables of congestion control */
 
+      conn->cc_ops           = listener->cc_ops;
       tcp_cc_init(conn);
 #endif
 
@@ -1181,7 +1403,7 @@ FAR struct tcp_conn_s *tcp_alloc_accept(FAR struct net_driver_s *dev,
        */
 
       tcp_conn_list_lock();
-      dq_addlast(&conn->sconn.node, &g_active_tcp_connections);
+      tcp_addconn(conn);
       tcp_conn_list_unlock();
 
       tcp_update_retrantimer(conn, TCP_RTO);
@@ -1490,7 +1712,7 @@ int tcp_connect(FAR struct tcp_conn_s *conn, FAR const struct sockaddr *addr)
   /* And, finally, put the connection structure into the active list. */
 
   tcp_conn_list_lock();
-  dq_addlast(&conn->sconn.node, &g_active_tcp_connections);
+  tcp_addconn(conn);
   tcp_conn_list_unlock();
 
   return OK;
@@ -1536,6 +1758,9 @@ void tcp_conn_list_unlock(void)
 void tcp_removeconn(FAR struct tcp_conn_s *conn)
 {
   dq_rem(&conn->sconn.node, &g_active_tcp_connections);
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  dq_rem(&conn->hnode, &g_tcp_conn_hash[tcp_conn_hash(conn)]);
+#endif
 }
 
 /****************************************************************************
@@ -28,6 +28,7 @@
 
 #include <sys/time.h>
 #include <stdint.h>
+#include <string.h>
 #include <errno.h>
 #include <assert.h>
 #include <nuttx/debug.h>
@@ -43,6 +44,75 @@
 
 #ifdef CONFIG_NET_TCPPROTO_OPTIONS
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: tcp_getinfo
+ *
+ * Description:
+ *   Fill in the TCP_INFO structure of a connection.
+ *
+ ****************************************************************************/
+
+static void tcp_getinfo(FAR struct tcp_conn_s *conn,
+                        FAR struct tcp_info *info)
+{
+  uint16_t mss = conn->mss > 0 ? conn->mss : 1;
+
+  memset(info, 0, sizeof(*info));
+
+  conn_lock(&conn->sconn);
+
+  info->tcpi_state       = conn->tcpstateflags & TCP_STATE_MASK;
+  info->tcpi_retransmits = conn->nrtx;
+  info->tcpi_rto         = conn->rto * USEC_PER_HSEC;
+  info->tcpi_snd_mss     = conn->mss;
+  info->tcpi_unacked     = (conn->tx_unacked + mss - 1) / mss;
+
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+  if ((conn->flags & TCP_WSCALE) != 0)
+    {
+      info->tcpi_options   |= TCPI_OPT_WSCALE;
+      info->tcpi_snd_wscale = conn->snd_scale;
+      info->tcpi_rcv_wscale = conn->rcv_scale;
+    }
+#endif
+
+  if ((conn->flags & TCP_SACK) != 0)
+    {
+      info->tcpi_options |= TCPI_OPT_SACK;
+    }
+
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+  if ((conn->flags & TCP_TSOPT) != 0)
+    {
+      info->tcpi_options |= TCPI_OPT_TIMESTAMPS;
+    }
+
+  if (conn->srtt != 0)
+    {
+      info->tcpi_rtt    = (conn->srtt >> 3) * USEC_PER_MSEC;
+      info->tcpi_rttvar = (conn->rttvar >> 2) * USEC_PER_MSEC;
+    }
+  else
+#endif
+    {
+      /* Only the coarse estimation of the retransmission timer */
+
+      info->tcpi_rtt    = (conn->sa >> 3) * USEC_PER_HSEC;
+      info->tcpi_rttvar = (conn->sv >> 2) * USEC_PER_HSEC;
+    }
+
+#ifdef CONFIG_NET_TCP_CC_NEWRENO
+  info->tcpi_snd_ssthresh = conn->ssthresh / mss;
+  info->tcpi_snd_cwnd     = conn->cwnd / mss;
+#endif
+
+  conn_unlock(&conn->sconn);
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -240,6 +310,41 @@ int tcp_getsockopt(FAR struct socket *psock, int option,
           }
         break;
 
+#ifdef CONFIG_NET_TCP_CC_NEWRENO
+      case TCP_CONGESTION: /* Congestion control algorithm */
+        if (*value_len == 0)
+          {
+            ret          = -EINVAL;
+          }
+        else
+          {
+            strlcpy(value, tcp_cc_name(conn),
+                    MIN(*value_len, TCP_CC_NAME_MAX));
+            *value_len   = strlen(value) + 1;
+            ret          = OK;
+          }
+        break;
+#endif
+
+      case TCP_INFO:     /* Connection state and statistics */
+        if (*value_len == 0)
+          {
+            ret          = -EINVAL;
+          }
+        else
+          {
+            struct tcp_info info;
+
+            tcp_getinfo(conn, &info);
+
+            /* Truncate to the size of the caller's structure */
+
+            *value_len   = MIN(*value_len, sizeof(struct tcp_info));
+            memcpy(value, &info, *value_len);
+            ret          = OK;
+          }
+        break;
+
       default:
         nerr("ERROR: Unrecognized TCP option: %d\n", option);
         ret = -ENOPROTOOPT;
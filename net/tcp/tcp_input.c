@@ -615,6 +615,15 @@ static void tcp_parse_option(FAR struct net_driver_s *dev,
         {
           conn->flags    |= TCP_SACK;
         }
+#endif
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+      else if (opt == TCP_OPT_TS &&
+               IPDATA(tcpiplen + 1 + i) == TCP_OPT_TS_LEN)
+        {
+          conn->ts_recent     = tcp_getsequence(IPBUF(tcpiplen + 2 + i));
+          conn->ts_recent_age = TICK2MSEC(clock_systime_ticks());
+          conn->flags        |= TCP_TSOPT;
+        }
 #endif
       else
         {
@@ -634,8 +643,160 @@ static void tcp_parse_option(FAR struct net_driver_s *dev,
 
       i += IPDATA(tcpiplen + 1 + i);
     }
+
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+  /* The Timestamps option takes room from the payload of every segment */
+
+  if ((conn->flags & TCP_TSOPT) != 0)
+    {
+      conn->mss -= TCP_OPT_TS_ALIGNED_LEN;
+    }
+#endif
+}
+
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+/****************************************************************************
+ * Name: tcp_parse_timestamp
+ *
+ * Description:
+ *   Find the Timestamps option of an incoming segment.
+ *
+ * Input Parameters:
+ *   dev    - The device driver structure containing the received TCP packet.
+ *   iplen  - Length of the IP header (IPv4_HDRLEN or IPv6_HDRLEN).
+ *   tsval  - Location to return the TSval of the segment
+ *   tsecr  - Location to return the TSecr of the segment
+ *
+ * Returned Value:
+ *   true if the segment carries the option.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+static bool tcp_parse_timestamp(FAR struct net_driver_s *dev,
+                                unsigned int iplen,
+                                FAR uint32_t *tsval, FAR uint32_t *tsecr)
+{
+  FAR struct tcp_hdr_s *tcp = IPBUF(iplen);
+  FAR uint8_t *opt = tcp->optdata;
+  int optlen = ((tcp->tcpoffset >> 4) - 5) << 2;
+  int i;
+
+  /* Fast path for the layout recommended by RFC 7323, Appendix A, which
+   * is also the one we send.
+   */
+
+  if (optlen >= TCP_OPT_TS_ALIGNED_LEN &&
+      opt[0] == TCP_OPT_NOOP && opt[1] == TCP_OPT_NOOP &&
+      opt[2] == TCP_OPT_TS && opt[3] == TCP_OPT_TS_LEN)
+    {
+      *tsval = tcp_getsequence(&opt[4]);
+      *tsecr = tcp_getsequence(&opt[8]);
+      return true;
+    }
+
+  for (i = 0; i < optlen; )
+    {
+      if (opt[i] == TCP_OPT_END)
+        {
+          break;
+        }
+      else if (opt[i] == TCP_OPT_NOOP)
+        {
+          i++;
+          continue;
+        }
+      else if (i + 1 >= optlen || opt[i + 1] < 2)
+        {
+          /* Malformed options */
+
+          break;
+        }
+      else if (opt[i] == TCP_OPT_TS && opt[i + 1] == TCP_OPT_TS_LEN &&
+               i + TCP_OPT_TS_LEN <= optlen)
+        {
+          *tsval = tcp_getsequence(&opt[i + 2]);
+          *tsecr = tcp_getsequence(&opt[i + 6]);
+          return true;
+        }
+
+      i += opt[i + 1];
+    }
+
+  return false;
 }
 
+/****************************************************************************
+ * Name: tcp_rtt_update
+ *
+ * Description:
+ *   Update the smoothed RTT and its variation with a new measurement
+ *   (RFC 6298) and derive the retransmission timeout from them.
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection of interest
+ *   rtt    - The measured round trip time in milliseconds
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+static void tcp_rtt_update(FAR struct tcp_conn_s *conn, uint32_t rtt)
+{
+  int32_t delta;
+#ifndef CONFIG_NET_TCP_FIXED_RTO
+  uint32_t rto;
+#endif
+
+  /* Ignore echoes of timestamps that we have not sent yet and bound the
+   * sample so that the scaled values cannot overflow.
+   */
+
+  if ((int32_t)rtt < 0)
+    {
+      return;
+    }
+
+  rtt = MAX(MIN(rtt, TCP_RTO_MAX * MSEC_PER_HSEC), 1);
+
+  if (conn->srtt == 0)
+    {
+      /* First measurement: SRTT = R, RTTVAR = R/2 */
+
+      conn->srtt   = rtt << 3;
+      conn->rttvar = rtt << 1;
+    }
+  else
+    {
+      /* SRTT = 7/8 SRTT + 1/8 R, RTTVAR = 3/4 RTTVAR + 1/4 |SRTT - R| */
+
+      delta = rtt - (conn->srtt >> 3);
+      conn->srtt += delta;
+      if (delta < 0)
+        {
+          delta = -delta;
+        }
+
+      delta -= conn->rttvar >> 2;
+      conn->rttvar += delta;
+    }
+
+#ifndef CONFIG_NET_TCP_FIXED_RTO
+  /* RTO = SRTT + 4 * RTTVAR, in units of the retransmission timer */
+
+  rto = (conn->srtt >> 3) + conn->rttvar;
+  rto = (rto + MSEC_PER_HSEC - 1) / MSEC_PER_HSEC;
+  conn->rto = MIN(MAX(rto, TCP_RTO_MIN), TCP_RTO_MAX);
+#endif
+}
+#endif /* CONFIG_NET_TCP_TIMESTAMPS */
+
 /****************************************************************************
  * Name: tcp_clear_zero_probe
  *
@@ -700,6 +861,11 @@ static void tcp_input(FAR struct net_driver_s *dev, uint8_t domain,
   uint16_t tmp16;
   uint16_t result;
   int      len;
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+  uint32_t tsval;
+  uint32_t tsecr;
+  bool     tsvalid = false;
+#endif
 
 #ifdef CONFIG_NET_STATISTICS
   /* Bump up the count of TCP packets received */
@@ -834,7 +1000,7 @@ static void tcp_input(FAR struct net_driver_s *dev, uint8_t domain,
             {
               if ((tcp->flags & TCP_RST) == 0)
                 {
-                  tcp_send(dev, conn, TCP_ACK, tcpiplen);
+                  tcp_send(dev, conn, TCP_ACK, tcpiplen + tcp_optlen(conn));
                   return;
                 }
               else
@@ -897,6 +1063,9 @@ static void tcp_input(FAR struct net_driver_s *dev, uint8_t domain,
 #  endif
     {
       net_ipv6addr_copy(&uaddr.ipv6.laddr, IPv6BUF->destipaddr);
+#ifdef CONFIG_NET_REUSEPORT
+      net_ipv6addr_copy(&uaddr.ipv6.raddr, IPv6BUF->srcipaddr);
+#endif
     }
 #endif
 
@@ -907,6 +1076,10 @@ static void tcp_input(FAR struct net_driver_s *dev, uint8_t domain,
     {
       net_ipv4addr_copy(uaddr.ipv4.laddr,
                         net_ip4addr_conv32(IPv4BUF->destipaddr));
+#ifdef CONFIG_NET_REUSEPORT
+      net_ipv4addr_copy(uaddr.ipv4.raddr,
+                        net_ip4addr_conv32(IPv4BUF->srcipaddr));
+#endif
     }
 #endif
 
@@ -931,6 +1104,12 @@ static void tcp_input(FAR struct net_driver_s *dev, uint8_t domain,
           goto drop;
         }
 
+#ifdef CONFIG_NET_REUSEPORT
+      /* Spread the connections over a SO_REUSEPORT group */
+
+      conn = tcp_reuseport_select(conn, &uaddr, tcp->srcport);
+#endif
+
       if (!tcp_backlogavailable(conn))
         {
           nerr("ERROR: no free containers for TCP BACKLOG!\n");
@@ -1064,6 +1243,40 @@ found:
       goto drop;
     }
 
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+  /* Once timestamps are negotiated, reject old duplicates whose timestamp
+   * is older than the last one we accepted (PAWS, RFC 7323 5.3) and
+   * remember the timestamp of in-sequence segments to echo it back.
+   */
+
+  if ((conn->flags & TCP_TSOPT) != 0 &&
+      tcp_parse_timestamp(dev, iplen, &tsval, &tsecr))
+    {
+      uint32_t now = TICK2MSEC(clock_systime_ticks());
+
+      if (TCP_SEQ_LT(tsval, conn->ts_recent) &&
+          now - conn->ts_recent_age <= TCP_PAWS_IDLE)
+        {
+#ifdef CONFIG_NET_STATISTICS
+          g_netstats.tcp.drop++;
+#endif
+          ninfo("PAWS: TSval %" PRIu32 " < TS.Recent %" PRIu32 "\n",
+                tsval, conn->ts_recent);
+          tcp_send(dev, conn, TCP_ACK, tcpiplen + tcp_optlen(conn));
+          return;
+        }
+
+      if (TCP_SEQ_LTE(tcp_getsequence(tcp->seqno),
+                      tcp_getsequence(conn->rcvseq)))
+        {
+          conn->ts_recent     = tsval;
+          conn->ts_recent_age = now;
+        }
+
+      tsvalid = true;
+    }
+#endif
+
   /* Calculated the length of the data, if the application has sent
    * any data to us.
    */
@@ -1170,7 +1383,7 @@ found:
             {
               /* old ack */
 
-              tcp_send(dev, conn, TCP_ACK, tcpiplen);
+              tcp_send(dev, conn, TCP_ACK, tcpiplen + tcp_optlen(conn));
               return;
             }
           else
@@ -1196,7 +1409,7 @@ found:
           if ((conn->tcpstateflags & TCP_STATE_MASK) >= TCP_ESTABLISHED &&
               (conn->tcpstateflags & TCP_STATE_MASK) <= TCP_LAST_ACK)
             {
-              tcp_send(dev, conn, TCP_ACK, tcpiplen);
+              tcp_send(dev, conn, TCP_ACK, tcpiplen + tcp_optlen(conn));
               return;
             }
           else if ((conn->tcpstateflags & TCP_STATE_MASK) == TCP_SYN_RCVD)
@@ -1233,10 +1446,23 @@ found:
         }
 #endif
 
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+      /* The echoed timestamp gives an RTT sample for every ACK of new
+       * data, also for retransmitted segments (RTTM, RFC 7323 4.1).
+       */
+
+      if (tsvalid && tsecr != 0 && conn->tx_unacked < lasttxunacked)
+        {
+          tcp_rtt_update(conn, TICK2MSEC(clock_systime_ticks()) - tsecr);
+        }
+#endif
+
 #ifndef CONFIG_NET_TCP_FIXED_RTO
-      /* Do RTT estimation, unless we have done retransmissions. */
+      /* Do RTT estimation, unless we have done retransmissions or the
+       * timestamps do it.
+       */
 
-      if (conn->nrtx == 0)
+      if (conn->nrtx == 0 && (conn->flags & TCP_TSOPT) == 0)
         {
           signed char m;
           m = conn->rto - conn->timer;
@@ -1333,7 +1559,7 @@ skip_rtt:
                    * E.g. a keep-alive segment.
                    */
 
-                  tcp_send(dev, conn, TCP_ACK, tcpiplen);
+                  tcp_send(dev, conn, TCP_ACK, tcpiplen + tcp_optlen(conn));
                   return;
                 }
             }
@@ -1344,7 +1570,7 @@ skip_rtt:
 
               tcp_input_ofosegs(dev, conn, iplen);
 #endif
-              tcp_send(dev, conn, TCP_ACK, tcpiplen);
+              tcp_send(dev, conn, TCP_ACK, tcpiplen + tcp_optlen(conn));
               return;
             }
         }
@@ -1702,7 +1928,7 @@ skip_rtt:
 
             net_incr32(conn->rcvseq, 1); /* ack FIN */
             tcp_callback(dev, conn, TCP_RXCLOSE);
-            tcp_send(dev, conn, TCP_ACK, tcpiplen);
+            tcp_send(dev, conn, TCP_ACK, tcpiplen + tcp_optlen(conn));
             return;
           }
         else if ((flags & TCP_ACKDATA) != 0 && conn->tx_unacked == 0)
@@ -1731,7 +1957,7 @@ skip_rtt:
 
             net_incr32(conn->rcvseq, 1); /* ack FIN */
             tcp_callback(dev, conn, TCP_RXCLOSE);
-            tcp_send(dev, conn, TCP_ACK, tcpiplen);
+            tcp_send(dev, conn, TCP_ACK, tcpiplen + tcp_optlen(conn));
             return;
           }
 
@@ -1745,7 +1971,7 @@ skip_rtt:
         goto drop;
 
       case TCP_TIME_WAIT:
-        tcp_send(dev, conn, TCP_ACK, tcpiplen);
+        tcp_send(dev, conn, TCP_ACK, tcpiplen + tcp_optlen(conn));
         return;
 
       case TCP_CLOSING:
@@ -50,13 +50,31 @@
 #include <stdbool.h>
 #include <nuttx/debug.h>
 
+#include <nuttx/nuttx.h>
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/net.h>
 
 #include "devif/devif.h"
 #include "inet/inet.h"
+#include "socket/socket.h"
 #include "tcp/tcp.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_CONN_HASH
+#  if (CONFIG_NET_TCP_LISTEN_HASHSIZE & \
+       (CONFIG_NET_TCP_LISTEN_HASHSIZE - 1)) != 0
+#    error CONFIG_NET_TCP_LISTEN_HASHSIZE must be a power of two
+#  endif
+
+/* Map a local port number (in network byte order) to a listener bucket */
+
+#  define TCP_LISTEN_HASH(p) \
+     (((p) ^ ((p) >> 8)) & (CONFIG_NET_TCP_LISTEN_HASHSIZE - 1))
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -65,6 +83,14 @@
 
 static FAR struct tcp_conn_s *tcp_listenports[CONFIG_NET_MAX_LISTENPORTS];
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+/* The same listeners indexed by local port number, used by the lookup of
+ * the listener for each received SYN.
+ */
+
+static dq_queue_t g_tcp_listen_hash[CONFIG_NET_TCP_LISTEN_HASHSIZE];
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -89,18 +115,35 @@ FAR struct tcp_conn_s *tcp_findlistener(FAR union ip_binding_u *uaddr,
                                         uint16_t portno)
 #endif
 {
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  FAR dq_entry_t *node;
+#else
   int ndx;
+#endif
 
-  /* Examine each connection structure in each slot of the listener list */
+  /* Examine each connection structure in each slot of the listener list,
+   * or only those in the hash bucket of this port if hashing is enabled.
+   */
 
   tcp_conn_list_lock();
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  for (node = dq_peek(&g_tcp_listen_hash[TCP_LISTEN_HASH(portno)]);
+       node != NULL; node = dq_next(node))
+#else
   for (ndx = 0; ndx < CONFIG_NET_MAX_LISTENPORTS; ndx++)
+#endif
     {
       /* Is this slot assigned?  If so, does the connection have the same
        * local port number?
        */
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+      FAR struct tcp_conn_s *conn =
+        container_of(node, struct tcp_conn_s, lnode);
+#else
       FAR struct tcp_conn_s *conn = tcp_listenports[ndx];
+#endif
+
 #if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
       if (tcp_conn_cmp(domain, (FAR const union ip_addr_u *)uaddr, portno,
                        conn))
@@ -119,6 +162,93 @@ FAR struct tcp_conn_s *tcp_findlistener(FAR union ip_binding_u *uaddr,
   return NULL;
 }
 
+/****************************************************************************
+ * Name: tcp_reuseport_hash
+ *
+ * Description:
+ *   Hash the remote address and port (network byte order) of a flow, used
+ *   to pick a listener of a SO_REUSEPORT group.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_REUSEPORT
+static uint32_t tcp_reuseport_hash(uint8_t domain,
+                                   FAR const union ip_binding_u *uaddr,
+                                   uint16_t rport)
+{
+  uint32_t key = rport;
+
+#ifdef CONFIG_NET_IPv6
+#ifdef CONFIG_NET_IPv4
+  if (domain == PF_INET6)
+#endif
+    {
+      FAR const uint16_t *raddr = uaddr->ipv6.raddr;
+      int i;
+
+      for (i = 0; i < 8; i += 2)
+        {
+          key ^= ((uint32_t)raddr[i] << 16) | raddr[i + 1];
+          key *= 0x45d9f3b;
+        }
+    }
+#endif /* CONFIG_NET_IPv6 */
+
+#ifdef CONFIG_NET_IPv4
+#ifdef CONFIG_NET_IPv6
+  else
+#endif
+    {
+      key ^= uaddr->ipv4.raddr;
+    }
+#endif /* CONFIG_NET_IPv4 */
+
+  key ^= key >> 16;
+  key *= 0x45d9f3b;
+  key ^= key >> 16;
+
+  return key;
+}
+
+/****************************************************************************
+ * Name: tcp_reuseport_group
+ *
+ * Description:
+ *   Return true if both listeners set SO_REUSEPORT and are bound to the
+ *   same domain, local address and port.
+ *
+ ****************************************************************************/
+
+static bool tcp_reuseport_group(FAR struct tcp_conn_s *conn1,
+                                FAR struct tcp_conn_s *conn2)
+{
+  if (!_SO_GETOPT(conn1->sconn.s_options, SO_REUSEPORT) ||
+      !_SO_GETOPT(conn2->sconn.s_options, SO_REUSEPORT) ||
+      conn1->domain != conn2->domain || conn1->lport != conn2->lport)
+    {
+      return false;
+    }
+
+#ifdef CONFIG_NET_IPv6
+#ifdef CONFIG_NET_IPv4
+  if (conn1->domain == PF_INET6)
+#endif
+    {
+      return net_ipv6addr_cmp(conn1->u.ipv6.laddr, conn2->u.ipv6.laddr);
+    }
+#endif /* CONFIG_NET_IPv6 */
+
+#ifdef CONFIG_NET_IPv4
+#ifdef CONFIG_NET_IPv6
+  else
+#endif
+    {
+      return net_ipv4addr_cmp(conn1->u.ipv4.laddr, conn2->u.ipv4.laddr);
+    }
+#endif /* CONFIG_NET_IPv4 */
+}
+#endif /* CONFIG_NET_REUSEPORT */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -145,6 +275,10 @@ int tcp_unlisten(FAR struct tcp_conn_s *conn)
       if (tcp_listenports[ndx] == conn)
         {
           tcp_listenports[ndx] = NULL;
+#ifdef CONFIG_NET_TCP_CONN_HASH
+          dq_rem(&conn->lnode,
+                 &g_tcp_listen_hash[TCP_LISTEN_HASH(conn->lport)]);
+#endif
           tcp_remove_syn_backlog(conn);
           ret = OK;
           break;
@@ -177,13 +311,22 @@ int tcp_listen(FAR struct tcp_conn_s *conn)
 
   tcp_conn_list_lock();
 
-  /* First, check if there is already a socket listening on this port */
+  /* First, check if there is already a socket listening on this port,
+   * unless they all allow to share it with SO_REUSEPORT.
+   */
 
 #if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
-  if (tcp_islistener(&conn->u, conn->lport, conn->domain))
+  if (tcp_islistener(&conn->u, conn->lport, conn->domain)
 #else
-  if (tcp_islistener(&conn->u, conn->lport))
+  if (tcp_islistener(&conn->u, conn->lport)
+#endif
+#ifdef CONFIG_NET_REUSEPORT
+      && (!_SO_GETOPT(conn->sconn.s_options, SO_REUSEPORT) ||
+          !tcp_listener_reusable(conn->domain,
+                                 (FAR const union ip_addr_u *)&conn->u,
+                                 conn->lport))
 #endif
+     )
     {
       /* Yes, then we must refuse this request */
 
@@ -208,6 +351,10 @@ int tcp_listen(FAR struct tcp_conn_s *conn)
               /* Yes.. we found it */
 
               tcp_listenports[ndx] = conn;
+#ifdef CONFIG_NET_TCP_CONN_HASH
+              dq_addlast(&conn->lnode,
+                         &g_tcp_listen_hash[TCP_LISTEN_HASH(conn->lport)]);
+#endif
               ret = OK;
               break;
             }
@@ -242,6 +389,105 @@ bool tcp_islistener(FAR union ip_binding_u *uaddr, uint16_t portno)
 }
 #endif
 
+/****************************************************************************
+ * Name: tcp_listener_reusable
+ *
+ * Description:
+ *   Return true if all the listeners on this local address and port set
+ *   SO_REUSEPORT, so that another socket setting it may share the port.
+ *
+ * Assumptions:
+ *   This function is called from network logic with the network locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_REUSEPORT
+bool tcp_listener_reusable(uint8_t domain, FAR const union ip_addr_u *ipaddr,
+                           uint16_t portno)
+{
+  FAR struct tcp_conn_s *conn;
+  bool reusable = true;
+  int ndx;
+
+  tcp_conn_list_lock();
+  for (ndx = 0; ndx < CONFIG_NET_MAX_LISTENPORTS && reusable; ndx++)
+    {
+      conn = tcp_listenports[ndx];
+
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+      if (tcp_conn_cmp(domain, ipaddr, portno, conn))
+#else
+      if (tcp_conn_cmp(ipaddr, portno, conn))
+#endif
+        {
+          reusable = _SO_GETOPT(conn->sconn.s_options, SO_REUSEPORT);
+        }
+    }
+
+  tcp_conn_list_unlock();
+  return reusable;
+}
+
+/****************************************************************************
+ * Name: tcp_reuseport_select
+ *
+ * Description:
+ *   Pick the listener of the SO_REUSEPORT group of listener that handles
+ *   the flow from the remote address in uaddr and rport.  The same flow
+ *   always picks the same listener as long as the group does not change,
+ *   so the SYN and the ACK completing the handshake agree.
+ *
+ * Assumptions:
+ *   This function is called from network logic with the network locked.
+ *
+ ****************************************************************************/
+
+FAR struct tcp_conn_s *
+tcp_reuseport_select(FAR struct tcp_conn_s *listener,
+                     FAR const union ip_binding_u *uaddr, uint16_t rport)
+{
+  FAR struct tcp_conn_s *conn;
+  uint32_t nconns = 0;
+  uint32_t pick;
+  int ndx;
+
+  if (!_SO_GETOPT(listener->sconn.s_options, SO_REUSEPORT))
+    {
+      return listener;
+    }
+
+  tcp_conn_list_lock();
+
+  /* Count the listeners of the group */
+
+  for (ndx = 0; ndx < CONFIG_NET_MAX_LISTENPORTS; ndx++)
+    {
+      conn = tcp_listenports[ndx];
+      if (conn != NULL && tcp_reuseport_group(listener, conn))
+        {
+          nconns++;
+        }
+    }
+
+  /* Then take the one the flow hashes to */
+
+  pick = tcp_reuseport_hash(listener->domain, uaddr, rport) % nconns;
+  for (ndx = 0; ndx < CONFIG_NET_MAX_LISTENPORTS; ndx++)
+    {
+      conn = tcp_listenports[ndx];
+      if (conn != NULL && tcp_reuseport_group(listener, conn) &&
+          pick-- == 0)
+        {
+          listener = conn;
+          break;
+        }
+    }
+
+  tcp_conn_list_unlock();
+  return listener;
+}
+#endif /* CONFIG_NET_REUSEPORT */
+
 /****************************************************************************
  * Name: tcp_accept_connection
  *
@@ -271,6 +517,10 @@ int tcp_accept_connection(FAR struct net_driver_s *dev,
 #endif
   if (listener != NULL)
     {
+#ifdef CONFIG_NET_REUSEPORT
+      listener = tcp_reuseport_select(listener, &conn->u, conn->rport);
+#endif
+
       /* Yes, there is a listener.  Is it accepting connections now? */
 
       if (listener->accept)
@@ -104,6 +104,36 @@ static inline FAR struct tcp_hdr_s *tcp_header(FAR struct net_driver_s *dev)
 #endif /* CONFIG_NET_IPv4 */
 }
 
+/****************************************************************************
+ * Name: tcp_timestamp_option
+ *
+ * Description:
+ *   Write the Timestamps option (RFC 7323), preceded by two NOPs.  TSval is
+ *   our clock in milliseconds.
+ *
+ * Input Parameters:
+ *   opt   - Where the option is written
+ *   tsecr - The timestamp echoed to the peer
+ *
+ * Returned Value:
+ *   The length of the option, TCP_OPT_TS_ALIGNED_LEN
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+static int tcp_timestamp_option(FAR uint8_t *opt, uint32_t tsecr)
+{
+  opt[0] = TCP_OPT_NOOP;
+  opt[1] = TCP_OPT_NOOP;
+  opt[2] = TCP_OPT_TS;
+  opt[3] = TCP_OPT_TS_LEN;
+  tcp_setsequence(&opt[4], TICK2MSEC(clock_systime_ticks()));
+  tcp_setsequence(&opt[8], tsecr);
+
+  return TCP_OPT_TS_ALIGNED_LEN;
+}
+#endif
+
 /****************************************************************************
  * Name: tcp_sendcommon
  *
@@ -289,6 +319,7 @@ void tcp_send(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn,
               uint16_t flags, uint16_t len)
 {
   FAR struct tcp_hdr_s *tcp;
+  int optlen;
 
   if (dev->d_iob == NULL)
     {
@@ -298,40 +329,61 @@ void tcp_send(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn,
   tcp        = tcp_header(dev);
   tcp->flags = flags;
   dev->d_len = len;
+  optlen     = 0;
+
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+  /* The Timestamps option goes in every segment, its room is already
+   * included in len (see tcpip_hdrsize()).
+   */
+
+  if ((conn->flags & TCP_TSOPT) != 0)
+    {
+      optlen = tcp_timestamp_option(tcp->optdata, conn->ts_recent);
+    }
+#endif
 
 #ifdef CONFIG_NET_TCP_SELECTIVE_ACK
   if ((conn->flags & TCP_SACK) && (flags == TCP_ACK) && conn->nofosegs > 0)
     {
-      int optlen = conn->nofosegs * sizeof(struct tcp_sack_s);
+      FAR uint8_t *sack = &tcp->optdata[optlen];
+      int nsack = conn->nofosegs;
+      int sacklen;
       int i;
 
-      tcp->optdata[0] = TCP_OPT_NOOP;
-      tcp->optdata[1] = TCP_OPT_NOOP;
-      tcp->optdata[2] = TCP_OPT_SACK;
-      tcp->optdata[3] = TCP_OPT_SACK_PERM_LEN + optlen;
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+      if (optlen > 0 && nsack > TCP_SACK_RANGES_TS)
+        {
+          nsack = TCP_SACK_RANGES_TS;
+        }
+#endif
+
+      sacklen = nsack * sizeof(struct tcp_sack_s);
 
-      optlen += 4;
+      sack[0] = TCP_OPT_NOOP;
+      sack[1] = TCP_OPT_NOOP;
+      sack[2] = TCP_OPT_SACK;
+      sack[3] = TCP_OPT_SACK_PERM_LEN + sacklen;
 
-      for (i = 0; i < conn->nofosegs; i++)
+      sacklen += 4;
+
+      for (i = 0; i < nsack; i++)
         {
           ninfo("TCP SACK [%d]"
                 "[%" PRIu32 " : %" PRIu32 " : %" PRIu32 "]\n", i,
                 conn->ofosegs[i].left, conn->ofosegs[i].right,
                 TCP_SEQ_SUB(conn->ofosegs[i].right, conn->ofosegs[i].left));
-          tcp_setsequence(&tcp->optdata[4 + i * 2 * sizeof(uint32_t)],
+          tcp_setsequence(&sack[4 + i * 2 * sizeof(uint32_t)],
                           conn->ofosegs[i].left);
-          tcp_setsequence(&tcp->optdata[4 + (i * 2 + 1) * sizeof(uint32_t)],
+          tcp_setsequence(&sack[4 + (i * 2 + 1) * sizeof(uint32_t)],
                           conn->ofosegs[i].right);
         }
 
-      dev->d_len += optlen;
-      tcp->tcpoffset = ((TCP_HDRLEN + optlen) / 4) << 4;
+      dev->d_len += sacklen;
+      optlen     += sacklen;
     }
-  else
 #endif /* CONFIG_NET_TCP_SELECTIVE_ACK */
-    {
-      tcp->tcpoffset = (TCP_HDRLEN / 4) << 4;
-    }
+
+  tcp->tcpoffset = ((TCP_HDRLEN + optlen) / 4) << 4;
 
   tcp_sendcommon(dev, conn, tcp);
 
@@ -623,9 +675,11 @@ void tcp_synack(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn,
 
   tcp = tcp_header(dev);
 
-  /* Set the packet length for the TCP Maximum Segment Size */
+  /* Set the packet length for the TCP Maximum Segment Size, the options
+   * of the SYN are added below.
+   */
 
-  dev->d_len = tcpip_hdrsize(conn);
+  dev->d_len = tcpip_hdrsize(conn) - tcp_optlen(conn);
 
   /* Set the packet length for the TCP Maximum Segment Size */
 
@@ -673,6 +727,20 @@ void tcp_synack(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn,
     }
 #endif
 
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+  /* Offer timestamps in our SYN, answer them only if the peer did */
+
+  if (tcp->flags == TCP_SYN)
+    {
+      optlen += tcp_timestamp_option(&tcp->optdata[optlen], 0);
+    }
+  else if ((conn->flags & TCP_TSOPT) != 0)
+    {
+      optlen += tcp_timestamp_option(&tcp->optdata[optlen],
+                                     conn->ts_recent);
+    }
+#endif
+
   tcp->tcpoffset         = ((TCP_HDRLEN + optlen) / 4) << 4;
   dev->d_len            += optlen;
 
@@ -738,7 +806,8 @@ void tcp_send_txnotify(FAR struct socket *psock,
  * Name: tcpip_hdrsize
  *
  * Description:
- *   Get the total size of L3 and L4 TCP header
+ *   Get the total size of L3 and L4 TCP header, including the options that
+ *   are carried by every segment of the connection.
  *
  * Input Parameters:
  *   conn     The connection structure associated with the socket
@@ -750,7 +819,7 @@ void tcp_send_txnotify(FAR struct socket *psock,
 
 uint16_t tcpip_hdrsize(FAR struct tcp_conn_s *conn)
 {
-  uint16_t hdrsize = sizeof(struct tcp_hdr_s);
+  uint16_t hdrsize = sizeof(struct tcp_hdr_s) + tcp_optlen(conn);
 
   UNUSED(conn);
   return net_ip_domain_select(conn->domain,
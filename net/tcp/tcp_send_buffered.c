@@ -411,6 +411,43 @@ static int parse_sack(FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp,
 }
 #endif /* CONFIG_NET_TCP_SELECTIVE_ACK */
 
+/****************************************************************************
+ * Name: tcp_send_maxlen
+ *
+ * Description:
+ *   Get the largest amount of new data that may be sent in one frame.  It
+ *   is the MSS, unless the device cuts TCP frames at the MTU itself and
+ *   the MSS of the connection (plus the options carried by every segment)
+ *   is the one derived from that MTU.
+ *
+ * Input Parameters:
+ *   dev  - The device driver structure to use in the send operation
+ *   conn - The TCP connection of interest
+ *
+ * Returned Value:
+ *   The maximum payload of the next frame, a multiple of the MSS.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NETDEV_TSO
+static uint32_t tcp_send_maxlen(FAR struct net_driver_s *dev,
+                                FAR struct tcp_conn_s *conn)
+{
+  if ((dev->d_features & NETDEV_TX_TSO) != 0 &&
+#ifdef NEED_IPDOMAIN_SUPPORT
+      conn->domain == PF_INET &&
+#endif
+      conn->mss + tcp_optlen(conn) == TCP_MSS(dev, IPv4_HDRLEN))
+    {
+      return CONFIG_NETDEV_TSO_MAXSIZE / conn->mss * conn->mss;
+    }
+
+  return conn->mss;
+}
+#else
+#  define tcp_send_maxlen(dev, conn) ((conn)->mss)
+#endif
+
 /****************************************************************************
  * Name: psock_send_eventhandler
  *
@@ -1062,9 +1099,9 @@ static uint32_t psock_send_eventhandler(FAR struct net_driver_s *dev,
           int ret;
 
           sndlen = TCP_WBPKTLEN(wrb) - TCP_WBSENT(wrb);
-          if (sndlen > conn->mss)
+          if (sndlen > tcp_send_maxlen(dev, conn))
             {
-              sndlen = conn->mss;
+              sndlen = tcp_send_maxlen(dev, conn);
             }
 
           remaining_snd_wnd = TCP_SEQ_SUB(snd_wnd_edge, seq);
@@ -420,6 +420,7 @@ ssize_t tcp_sendfile(FAR struct socket *psock, FAR struct file *infile,
   FAR struct tcp_conn_s *conn;
   struct sendfile_s state;
   off_t startpos;
+  off_t curpos;
   int ret = OK;
 
   conn = psock->s_conn;
@@ -549,29 +550,33 @@ errout_locked:
 #endif
   conn_dev_unlock(&conn->sconn, conn->dev);
 
-  /* Return the current file position */
+  /* Return the file position past the data that was sent.  It is worked
+   * out here rather than taken from the file: devif_file_send() does not
+   * read the file when the data lies in memory (FIOC_GETEXTENT), and a
+   * retransmission reads from an earlier offset.
+   */
 
-  if (offset)
+  curpos = state.snd_foffset;
+  if (state.snd_sent > 0)
     {
-      /* Use lseek to get the current file position */
-
-      off_t curpos = file_seek(infile, 0, SEEK_CUR);
-      if (curpos < 0)
-        {
-          return curpos;
-        }
+      curpos += state.snd_sent;
+    }
 
+  if (offset)
+    {
       /* Return the current file position */
 
       *offset = curpos;
 
-      /* Use lseek again to restore the original file position */
+      /* Use lseek to restore the original file position */
 
-      startpos = file_seek(infile, startpos, SEEK_SET);
-      if (startpos < 0)
-        {
-          return startpos;
-        }
+      curpos = startpos;
+    }
+
+  curpos = file_seek(infile, curpos, SEEK_SET);
+  if (curpos < 0)
+    {
+      return curpos;
     }
 
   if (ret < 0)
@@ -28,6 +28,7 @@
 
 #include <sys/time.h>
 #include <stdint.h>
+#include <string.h>
 #include <errno.h>
 #include <assert.h>
 #include <nuttx/debug.h>
@@ -263,6 +264,31 @@ int tcp_setsockopt(FAR struct socket *psock, int option,
           }
         break;
 
+#ifdef CONFIG_NET_TCP_CC_NEWRENO
+      case TCP_CONGESTION: /* Congestion control algorithm */
+        {
+          char name[TCP_CC_NAME_MAX];
+          size_t len;
+
+          /* The name needs not to be NUL terminated */
+
+          len = strnlen(value, value_len);
+          if (len == 0 || len >= TCP_CC_NAME_MAX)
+            {
+              ret = -EINVAL;
+              break;
+            }
+
+          memcpy(name, value, len);
+          name[len] = '\0';
+
+          conn_dev_lock(&conn->sconn, conn->dev);
+          ret = tcp_cc_select(conn, name);
+          conn_dev_unlock(&conn->sconn, conn->dev);
+        }
+        break;
+#endif
+
       default:
         nerr("ERROR: Unrecognized TCP option: %d\n", option);
         ret = -ENOPROTOOPT;
@@ -49,6 +49,15 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* The UDP payload is summed while it is copied into the write buffer, so
+ * udp_send() only has to sum the headers.
+ */
+
+#if defined(CONFIG_NET_UDP_WRITE_BUFFERS) && \
+    defined(CONFIG_NET_UDP_CHECKSUMS) && !defined(CONFIG_NET_ARCH_CHKSUM)
+#  define UDP_COPY_CHKSUM 1
+#endif
+
 #ifdef CONFIG_NET_UDP_WRITE_BUFFERS
 /* UDP write buffer dump macros */
 
@@ -70,6 +79,7 @@
 /* Definitions for the UDP connection struct flag field */
 
 #define _UDP_FLAG_CONNECTMODE (1 << 0) /* Bit 0:  UDP connection-mode */
+#define _UDP_FLAG_PLDSUM      (1 << 1) /* Bit 1:  pldsum is valid for send */
 
 #define _UDP_ISCONNECTMODE(f) (((f) & _UDP_FLAG_CONNECTMODE) != 0)
 
@@ -134,6 +144,13 @@ struct udp_conn_s
 
   FAR struct iob_s *readahead;   /* Read-ahead buffering */
 
+#ifdef CONFIG_NET_UDP_RECV_ZEROCOPY
+  /* Datagrams lent to the application by recvmsg(MSG_ZCRECV) */
+
+  FAR struct iob_s *zclent[CONFIG_NET_UDP_RECV_ZEROCOPY_NLENT];
+  uint32_t zclentlen;            /* Bytes lent, charged against rcvbufs */
+#endif
+
 #ifdef CONFIG_NET_UDP_WRITE_BUFFERS
   /* Write buffering
    *
@@ -143,6 +160,9 @@ struct udp_conn_s
 
   sq_queue_t write_q;             /* Write buffering for UDP packets */
   FAR struct net_driver_s *dev;   /* Last device */
+#ifdef UDP_COPY_CHKSUM
+  uint16_t pldsum;                /* Payload sum of the packet being sent */
+#endif
 
   /* Callback instance for UDP sendto() */
 
@@ -175,6 +195,9 @@ struct udp_wrbuffer_s
   sq_entry_t wb_node;              /* Supports a singly linked list */
   struct sockaddr_storage wb_dest; /* Destination address */
   FAR struct iob_s *wb_iob;        /* Head of the I/O buffer chain */
+#ifdef UDP_COPY_CHKSUM
+  uint16_t wb_chksum;              /* Raw sum of the payload */
+#endif
 };
 #endif
 
@@ -240,6 +263,24 @@ FAR struct udp_conn_s *udp_active(FAR struct net_driver_s *dev,
                                   FAR struct udp_conn_s *conn,
                                   FAR struct udp_hdr_s *udp);
 
+/****************************************************************************
+ * Name: udp_reuseport_select
+ *
+ * Description:
+ *   Pick the socket of a SO_REUSEPORT group that receives a unicast
+ *   datagram, given the first connection matching it.
+ *
+ * Assumptions:
+ *   Called from network stack logic with the network stack locked
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_REUSEPORT
+FAR struct udp_conn_s *udp_reuseport_select(FAR struct net_driver_s *dev,
+                                            FAR struct udp_conn_s *conn,
+                                            FAR struct udp_hdr_s *udp);
+#endif
+
 /****************************************************************************
  * Name: udp_nextconn
  *
@@ -77,10 +77,19 @@ static uint16_t udp_datahandler(FAR struct net_driver_s *dev,
   uint8_t src_addr_size;
   FAR void *src_addr;
   int offset;
+#if CONFIG_NET_RECV_BUFSIZE > 0
+  uint32_t queued;
+#endif
 
   conn_lock(&conn->sconn);
 #if CONFIG_NET_RECV_BUFSIZE > 0
-  if (conn->readahead && conn->readahead->io_pktlen > conn->rcvbufs)
+  queued = conn->readahead != NULL ? conn->readahead->io_pktlen : 0;
+#  ifdef CONFIG_NET_UDP_RECV_ZEROCOPY
+  /* Datagrams lent to the application still occupy the receive buffer */
+
+  queued += conn->zclentlen;
+#  endif
+  if (queued > conn->rcvbufs)
     {
       conn_unlock(&conn->sconn);
       netdev_iob_release(dev);
@@ -112,6 +112,7 @@ static dq_queue_t g_active_udp_connections;
  *   portno - The port to use in the lookup
  *   opt    - The option from another conn to match the conflict conn
  *              SO_REUSEADDR: If both sockets have this, they never conflict.
+ *              SO_REUSEPORT: Same as SO_REUSEADDR.
  *
  * Assumptions:
  *   This function must be called with the network locked.
@@ -126,6 +127,9 @@ static FAR struct udp_conn_s *udp_find_conn(uint8_t domain,
 #ifdef CONFIG_NET_SOCKOPTS
   bool skip_reusable = _SO_GETOPT(opt, SO_REUSEADDR);
 #endif
+#ifdef CONFIG_NET_REUSEPORT
+  bool skip_reuseport = _SO_GETOPT(opt, SO_REUSEPORT);
+#endif
 
   /* Now search each connection structure. */
 
@@ -143,6 +147,14 @@ static FAR struct udp_conn_s *udp_find_conn(uint8_t domain,
         }
 #endif
 
+#ifdef CONFIG_NET_REUSEPORT
+      if (skip_reuseport &&
+          _SO_GETOPT(conn->sconn.s_options, SO_REUSEPORT))
+        {
+          continue;
+        }
+#endif
+
       /* If the port local port number assigned to the connections matches
        * AND the IP address of the connection matches, then return a
        * reference to the connection structure.  INADDR_ANY is a special
@@ -597,6 +609,9 @@ FAR struct udp_conn_s *udp_alloc(uint8_t domain)
 
 void udp_free(FAR struct udp_conn_s *conn)
 {
+#ifdef CONFIG_NET_UDP_RECV_ZEROCOPY
+  int i;
+#endif
 #ifdef CONFIG_NET_UDP_WRITE_BUFFERS
   FAR struct udp_wrbuffer_s *wrbuffer;
 #endif
@@ -617,6 +632,18 @@ void udp_free(FAR struct udp_conn_s *conn)
 
   iob_free_chain(conn->readahead);
 
+#ifdef CONFIG_NET_UDP_RECV_ZEROCOPY
+  /* Release the datagrams still lent to the application */
+
+  for (i = 0; i < CONFIG_NET_UDP_RECV_ZEROCOPY_NLENT; i++)
+    {
+      iob_free_chain(conn->zclent[i]);
+      conn->zclent[i] = NULL;
+    }
+
+  conn->zclentlen = 0;
+#endif
+
 #ifdef CONFIG_NET_UDP_WRITE_BUFFERS
   /* Release any write buffers attached to the connection */
 
@@ -680,6 +707,97 @@ FAR struct udp_conn_s *udp_active(FAR struct net_driver_s *dev,
 #endif /* CONFIG_NET_IPv4 */
 }
 
+/****************************************************************************
+ * Name: udp_reuseport_select
+ *
+ * Description:
+ *   Spread the datagrams received on a port shared with SO_REUSEPORT: pick
+ *   one of the unconnected sockets matching the datagram, by a hash of its
+ *   source address and port, so that a flow always goes to the same socket.
+ *
+ * Input Parameters:
+ *   dev  - The device driver structure containing the received packet
+ *   conn - The first connection matching the packet (see udp_active)
+ *   udp  - The UDP header of the packet
+ *
+ * Assumptions:
+ *   This function must be called with the network locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_REUSEPORT
+FAR struct udp_conn_s *udp_reuseport_select(FAR struct net_driver_s *dev,
+                                            FAR struct udp_conn_s *conn,
+                                            FAR struct udp_hdr_s *udp)
+{
+  FAR struct udp_conn_s *next;
+  uint32_t key = udp->srcport;
+  uint32_t nconns = 0;
+
+  if (!_SO_GETOPT(conn->sconn.s_options, SO_REUSEPORT) ||
+      _UDP_ISCONNECTMODE(conn->flags))
+    {
+      return conn;
+    }
+
+  /* Count the unconnected sockets of the group */
+
+  for (next = conn; next != NULL; next = udp_active(dev, next, udp))
+    {
+      if (_SO_GETOPT(next->sconn.s_options, SO_REUSEPORT) &&
+          !_UDP_ISCONNECTMODE(next->flags))
+        {
+          nconns++;
+        }
+    }
+
+  /* Hash the source address and port */
+
+#ifdef CONFIG_NET_IPv6
+#ifdef CONFIG_NET_IPv4
+  if (IFF_IS_IPv6(dev->d_flags))
+#endif
+    {
+      FAR const uint16_t *srcipaddr = IPv6BUF->srcipaddr;
+      int i;
+
+      for (i = 0; i < 8; i += 2)
+        {
+          key ^= ((uint32_t)srcipaddr[i] << 16) | srcipaddr[i + 1];
+          key *= 0x45d9f3b;
+        }
+    }
+#endif /* CONFIG_NET_IPv6 */
+
+#ifdef CONFIG_NET_IPv4
+#ifdef CONFIG_NET_IPv6
+  else
+#endif
+    {
+      key ^= net_ip4addr_conv32(IPv4BUF->srcipaddr);
+    }
+#endif /* CONFIG_NET_IPv4 */
+
+  key ^= key >> 16;
+  key *= 0x45d9f3b;
+  key ^= key >> 16;
+  key %= nconns;
+
+  /* Then take the one the flow hashes to */
+
+  for (next = conn; next != NULL; next = udp_active(dev, next, udp))
+    {
+      if (_SO_GETOPT(next->sconn.s_options, SO_REUSEPORT) &&
+          !_UDP_ISCONNECTMODE(next->flags) && key-- == 0)
+        {
+          return next;
+        }
+    }
+
+  return conn;
+}
+#endif /* CONFIG_NET_REUSEPORT */
+
 /****************************************************************************
  * Name: udp_conn_list_lock
  *
@@ -151,6 +151,27 @@ int udp_ioctl(FAR struct udp_conn_s *conn, int cmd, unsigned long arg)
       case FIOC_FILEPATH:
         udp_path(conn, (FAR char *)(uintptr_t)arg, PATH_MAX);
         break;
+#ifdef CONFIG_NET_UDP_RECV_ZEROCOPY
+      case SIOCZCRELEASE:
+        {
+          int i;
+
+          ret = -EINVAL;
+          for (i = 0; i < CONFIG_NET_UDP_RECV_ZEROCOPY_NLENT; i++)
+            {
+              iob = conn->zclent[i];
+              if (iob != NULL && (uintptr_t)IOB_DATA(iob) == arg)
+                {
+                  conn->zclentlen -= iob->io_pktlen;
+                  iob_free_chain(iob);
+                  conn->zclent[i] = NULL;
+                  ret = OK;
+                  break;
+                }
+            }
+        }
+        break;
+#endif
       default:
         ret = -ENOTTY;
         break;
@@ -170,6 +170,151 @@ static inline size_t udp_recvfrom_newdata(FAR struct net_driver_s *dev,
   return recvlen;
 }
 
+/****************************************************************************
+ * Name: udp_readahead_lend
+ *
+ * Description:
+ *   Detach the datagram at the head of the read-ahead buffer and lend its
+ *   I/O buffers to the application through msg_iov[], instead of copying
+ *   the payload.
+ *
+ * Input Parameters:
+ *   pstate  - the recvfrom state structure
+ *   offset  - The offset of the payload in the read-ahead buffer
+ *   datalen - The length of the payload
+ *
+ * Returned Value:
+ *   Zero (OK) if the datagram was lent; a negated errno value if it must be
+ *   copied instead.  The read-ahead buffer is unchanged on failure.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_UDP_RECV_ZEROCOPY
+static int udp_readahead_lend(FAR struct udp_recvfrom_s *pstate,
+                              unsigned int offset, unsigned int datalen)
+{
+  FAR struct udp_conn_s *conn = pstate->ir_conn;
+  FAR struct msghdr *msg = pstate->ir_msg;
+  FAR struct iob_s *iob = conn->readahead;
+  FAR struct iob_s *rest = NULL;
+  FAR struct iob_s *tail;
+  unsigned int end = offset + datalen;
+  unsigned int pos;
+  unsigned long nseg = 0;
+  int slot;
+
+  if ((pstate->ir_flags & MSG_PEEK) != 0 || datalen == 0)
+    {
+      return -EINVAL;
+    }
+
+  for (slot = 0; slot < CONFIG_NET_UDP_RECV_ZEROCOPY_NLENT; slot++)
+    {
+      if (conn->zclent[slot] == NULL)
+        {
+          break;
+        }
+    }
+
+  if (slot >= CONFIG_NET_UDP_RECV_ZEROCOPY_NLENT)
+    {
+      return -ENOBUFS;
+    }
+
+  /* Find the I/O buffer holding the end of the datagram, counting the
+   * I/O buffers that carry payload.
+   */
+
+  tail = iob;
+  pos  = 0;
+  for (; ; )
+    {
+      if (pos + tail->io_len > offset && tail->io_len > 0)
+        {
+          nseg++;
+        }
+
+      pos += tail->io_len;
+      if (pos >= end)
+        {
+          break;
+        }
+
+      tail = tail->io_flink;
+    }
+
+  if (nseg > msg->msg_iovlen)
+    {
+      return -EMSGSIZE;
+    }
+
+  /* Split the rest of the read-ahead buffer off the datagram */
+
+  if (pos > end)
+    {
+      /* The next datagram was packed into the same I/O buffer
+       * (CONFIG_NET_RECV_PACK), move its beginning to a new one.
+       */
+
+      rest = iob_tryalloc(false);
+      if (rest == NULL)
+        {
+          return -ENOMEM;
+        }
+
+      if (iob_trycopyin(rest, &tail->io_data[tail->io_offset +
+                                              tail->io_len - (pos - end)],
+                        pos - end, 0, false) < 0)
+        {
+          iob_free_chain(rest);
+          return -ENOMEM;
+        }
+
+      tail->io_len -= pos - end;
+      if (tail->io_flink != NULL)
+        {
+          iob_concat(rest, tail->io_flink);
+        }
+    }
+  else
+    {
+      rest = tail->io_flink;
+    }
+
+  if (rest != NULL)
+    {
+      rest->io_pktlen = iob->io_pktlen - end;
+    }
+
+  tail->io_flink  = NULL;
+  iob->io_pktlen  = end;
+  conn->readahead = rest;
+
+  /* Drop the saved connection information and lend the payload */
+
+  iob = iob_trimhead(iob, offset);
+  conn->zclent[slot] = iob;
+  conn->zclentlen   += iob->io_pktlen;
+
+  for (nseg = 0; iob != NULL; iob = iob->io_flink)
+    {
+      if (iob->io_len > 0)
+        {
+          msg->msg_iov[nseg].iov_base = IOB_DATA(iob);
+          msg->msg_iov[nseg].iov_len  = iob->io_len;
+          nseg++;
+        }
+    }
+
+  msg->msg_iovlen = nseg;
+  msg->msg_flags |= MSG_ZCRECV;
+  return OK;
+}
+#endif
+
 static inline void udp_readahead(struct udp_recvfrom_s *pstate)
 {
   FAR struct udp_conn_s *conn = pstate->ir_conn;
@@ -235,18 +380,31 @@ static inline void udp_readahead(struct udp_recvfrom_s *pstate)
       offset += sizeof(struct timespec);
 #endif
 
-      /* Copy to user */
+#ifdef CONFIG_NET_UDP_RECV_ZEROCOPY
+      /* Lend to user if requested and possible */
 
-      recvlen = iob_copyout(pstate->ir_msg->msg_iov->iov_base, iob,
-                            MIN(pstate->ir_msg->msg_iov->iov_len, datalen),
-                            offset);
+      if ((pstate->ir_flags & MSG_ZCRECV) != 0 &&
+          udp_readahead_lend(pstate, offset, datalen) >= 0)
+        {
+          recvlen = datalen;
+          iob     = NULL;
+        }
+      else
+#endif
+        {
+          /* Copy to user */
+
+          recvlen = iob_copyout(pstate->ir_msg->msg_iov->iov_base, iob,
+                                MIN(pstate->ir_msg->msg_iov->iov_len,
+                                    datalen),
+                                offset);
+        }
 
       /* Update the accumulated size of the data read */
 
       pstate->ir_recvlen = recvlen;
 
-      ninfo("Received %d bytes (of %d, total %d)\n",
-            recvlen, datalen, iob->io_pktlen);
+      ninfo("Received %d bytes (of %d)\n", recvlen, datalen);
 
       if (pstate->ir_msg->msg_name)
         {
@@ -262,7 +420,7 @@ static inline void udp_readahead(struct udp_recvfrom_s *pstate)
 
       /* Remove the packet from the head of the I/O buffer chain. */
 
-      if (!(pstate->ir_flags & MSG_PEEK))
+      if (iob != NULL && !(pstate->ir_flags & MSG_PEEK))
         {
           if (offset + datalen >= iob->io_pktlen)
             {
@@ -277,6 +435,41 @@ static inline void udp_readahead(struct udp_recvfrom_s *pstate)
     }
 }
 
+/****************************************************************************
+ * Name: udp_readahead_rewait
+ *
+ * Description:
+ *   A blocking MSG_ZCRECV receive is woken up without the datagram, which
+ *   is lent from the read-ahead buffer here.  If it is not there (another
+ *   reader took it, or it could not be buffered), the receive waits for
+ *   the next one like a receive that copies.
+ *
+ * Input Parameters:
+ *   pstate - The recvfrom state structure
+ *   result - The result of the wait
+ *
+ * Returned Value:
+ *   True if the receive has to wait again.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_UDP_RECV_ZEROCOPY
+static bool udp_readahead_rewait(FAR struct udp_recvfrom_s *pstate,
+                                 int result)
+{
+  if (result < 0 || pstate->ir_result != OK ||
+      (pstate->ir_flags & MSG_ZCRECV) == 0 || pstate->ir_recvlen >= 0)
+    {
+      return false;
+    }
+
+  udp_readahead(pstate);
+  return pstate->ir_recvlen < 0;
+}
+#else
+#  define udp_readahead_rewait(s, r) false
+#endif
+
 /****************************************************************************
  * Name: udp_sender
  *
@@ -467,6 +660,18 @@ static uint32_t udp_eventhandler(FAR struct net_driver_s *dev,
 
       else if ((flags & UDP_NEWDATA) != 0)
         {
+#ifdef CONFIG_NET_UDP_RECV_ZEROCOPY
+          /* The datagram can only be lent from the read-ahead buffer, so
+           * leave it to udp_callback() and pick it up after the wakeup.
+           */
+
+          if ((pstate->ir_flags & MSG_ZCRECV) != 0)
+            {
+              udp_terminate(pstate, OK);
+              return flags;
+            }
+#endif
+
           /* Save packet timestamp, if requested */
 
 #ifdef CONFIG_NET_TIMESTAMP
@@ -685,7 +890,12 @@ ssize_t psock_udp_recvfrom(FAR struct socket *psock, FAR struct msghdr *msg,
 
   /* Perform the UDP recvfrom() operation */
 
+#ifdef CONFIG_NET_UDP_RECV_ZEROCOPY
+  if (msg->msg_iovlen < 1 ||
+      (msg->msg_iovlen != 1 && (flags & MSG_ZCRECV) == 0))
+#else
   if (msg->msg_iovlen != 1)
+#endif
     {
       return -ENOTSUP;
     }
@@ -748,12 +958,6 @@ ssize_t psock_udp_recvfrom(FAR struct socket *psock, FAR struct msghdr *msg,
       state.ir_cb = udp_callback_alloc(dev, conn);
       if (state.ir_cb)
         {
-          /* Set up the callback in the connection */
-
-          state.ir_cb->flags = (UDP_NEWDATA | NETDEV_DOWN);
-          state.ir_cb->priv  = (FAR void *)&state;
-          state.ir_cb->event = udp_eventhandler;
-
           /* Push a cancellation point onto the stack.  This will be
            * called if the thread is canceled.
            */
@@ -764,23 +968,35 @@ ssize_t psock_udp_recvfrom(FAR struct socket *psock, FAR struct msghdr *msg,
           info.sem = &state.ir_sem;
           tls_cleanup_push(tls_get_info(), udp_callback_cleanup, &info);
 
-          /* Wait for either the receive to complete or for an error/timeout
-           * to occur.  conn_dev_sem_timedwait will also terminate if a
-           * signal is received.
-           */
-
-          ret = conn_dev_sem_timedwait(&state.ir_sem, true,
-                                       _SO_TIMEOUT(conn->sconn.s_rcvtimeo),
-                                       &conn->sconn, dev);
-          tls_cleanup_pop(tls_get_info(), 0);
-          if (ret == -ETIMEDOUT)
+          do
             {
-              ret = -EAGAIN;
+              /* Set up the callback in the connection */
+
+              state.ir_cb->flags = (UDP_NEWDATA | NETDEV_DOWN);
+              state.ir_cb->priv  = (FAR void *)&state;
+              state.ir_cb->event = udp_eventhandler;
+
+              /* Wait for either the receive to complete or for an
+               * error/timeout to occur.  conn_dev_sem_timedwait will also
+               * terminate if a signal is received.
+               */
+
+              ret = conn_dev_sem_timedwait(&state.ir_sem, true,
+                                   _SO_TIMEOUT(conn->sconn.s_rcvtimeo),
+                                   &conn->sconn, dev);
+              if (ret == -ETIMEDOUT)
+                {
+                  ret = -EAGAIN;
+                }
             }
+          while (udp_readahead_rewait(&state, ret));
+
+          tls_cleanup_pop(tls_get_info(), 0);
 
           /* Make sure that no further events are processed */
 
           udp_callback_free(dev, conn, state.ir_cb);
+
           ret = udp_recvfrom_result(ret, &state);
         }
       else
@@ -252,6 +252,17 @@ void udp_send(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn)
 
       if ((dev->d_features & NETDEV_TX_CSUM) == 0)
         {
+#ifdef UDP_COPY_CHKSUM
+          /* The payload was summed when it was copied into the write
+           * buffer, only the headers are left to sum.
+           */
+
+          if ((conn->flags & _UDP_FLAG_PLDSUM) != 0)
+            {
+              udp->udpchksum = ~udp_chksum_payload(dev, conn->pldsum);
+            }
+          else
+#endif
 #ifdef CONFIG_NET_IPv4
 #ifdef CONFIG_NET_IPv6
           if (IFF_IS_IPv4(dev->d_flags))
@@ -309,6 +320,12 @@ void udp_send(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn)
 #endif /* CONFIG_NET_MLD */
 #endif /* CONFIG_NET_SOCKOPTS */
     }
+
+#ifdef UDP_COPY_CHKSUM
+  /* The payload sum only applies to this packet */
+
+  conn->flags &= ~_UDP_FLAG_PLDSUM;
+#endif
 }
 
 /****************************************************************************
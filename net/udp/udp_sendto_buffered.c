@@ -473,6 +473,13 @@ static uint32_t sendto_eventhandler(FAR struct net_driver_s *dev,
       dev->d_sndlen = wrb->wb_iob->io_pktlen - udpiplen;
       ninfo("wrb=%p sndlen=%d\n", wrb, dev->d_sndlen);
 
+#ifdef UDP_COPY_CHKSUM
+      /* Hand the payload sum to udp_send() */
+
+      conn->pldsum = wrb->wb_chksum;
+      conn->flags |= _UDP_FLAG_PLDSUM;
+#endif
+
       /* Do not need to release wb_iob, the life cycle of wb_iob is
        * handed over to the network device
        */
@@ -838,8 +845,20 @@ ssize_t psock_udp_sendto(FAR struct socket *psock, FAR const void *buf,
    * buffer space if the socket was opened non-blocking.
    */
 
+#ifdef UDP_COPY_CHKSUM
+  /* Sum the payload while it is copied in, it is then not read again
+   * when the checksum is calculated in udp_send().
+   */
+
+  wrb->wb_chksum = 0;
+#endif
+
   if (len > 0)
     {
+#ifdef UDP_COPY_CHKSUM
+      ret = chksum_copyin_iob(wrb->wb_iob, (FAR const uint8_t *)buf,
+                              len, false, !nonblock, &wrb->wb_chksum);
+#else
       if (nonblock)
         {
           ret = iob_trycopyin(wrb->wb_iob, (FAR uint8_t *)buf,
@@ -850,6 +869,7 @@ ssize_t psock_udp_sendto(FAR struct socket *psock, FAR const void *buf,
           ret = iob_copyin(wrb->wb_iob, (FAR uint8_t *)buf,
                            len, udpiplen, false);
         }
+#endif
 
       if (ret < 0)
         {
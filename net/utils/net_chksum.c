@@ -27,23 +27,277 @@
 #include <nuttx/config.h>
 #ifdef CONFIG_NET
 
+#include <errno.h>
+#include <string.h>
+
+#include <nuttx/mm/iob.h>
+
 #include "utils/utils.h"
 
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+#ifndef CONFIG_NET_ARCH_CHKSUM
+
+/****************************************************************************
+ * Name: chksum_swap
+ *
+ * Description:
+ *   Swap the bytes of a partial sum.  The one's complement sum of a byte
+ *   stream that starts one byte into a 16-bit word is the byte swapped sum
+ *   of the same stream starting on a word boundary (RFC 1071, 2.B).
+ *
+ ****************************************************************************/
+
+static inline uint16_t chksum_swap(uint16_t sum)
+{
+  return (uint16_t)((sum << 8) | (sum >> 8));
+}
+
+/****************************************************************************
+ * Name: chksum_fold
+ *
+ * Description:
+ *   Fold a wide accumulator of native 16-bit words into a 16-bit one's
+ *   complement sum in network word order.
+ *
+ ****************************************************************************/
+
+static inline uint16_t chksum_fold(uint64_t acc)
+{
+  acc = (acc & 0xffffffff) + (acc >> 32);
+  acc = (acc & 0xffffffff) + (acc >> 32);
+  acc = (acc & 0xffff) + (acc >> 16);
+  acc = (acc & 0xffff) + (acc >> 16);
+  acc = (acc & 0xffff) + (acc >> 16);
+
+  return NTOHS((uint16_t)acc);
+}
+
 /****************************************************************************
- * Name: checksum
+ * Name: chksum_tail
+ *
+ * Description:
+ *   Return a trailing odd byte as a native 16-bit word padded with zero.
+ *
+ ****************************************************************************/
+
+static inline uint16_t chksum_tail(uint8_t byte)
+{
+  uint8_t word[2];
+  uint16_t tail;
+
+  word[0] = byte;
+  word[1] = 0;
+  memcpy(&tail, word, sizeof(tail));
+  return tail;
+}
+
+/****************************************************************************
+ * Name: chksum_aligned and chksum_copy_aligned
+ *
+ * Description:
+ *   Sum (and copy) data that starts on a 16-bit boundary.  The data is
+ *   loaded a 32-bit word at a time into a 64-bit accumulator, so there is
+ *   no carry to handle until the final fold.  For the copy, dest must have
+ *   the same alignment as data.  The sum alone uses the SIMD routine of
+ *   the architecture if CONFIG_LIBC_ARCH_CHKSUM is defined.
+ *
+ * Returned Value:
+ *   The sum in host byte order.
+ *
+ ****************************************************************************/
+
+static uint16_t chksum_aligned(FAR const uint8_t *data, size_t len)
+{
+#ifdef CONFIG_LIBC_ARCH_CHKSUM
+  return chksum_fold(up_chksum_words(data, len));
+#else
+  FAR const uint32_t *words;
+  uint64_t acc = 0;
+
+  if (((uintptr_t)data & 2) != 0 && len >= 2)
+    {
+      acc  += *(FAR const uint16_t *)data;
+      data += 2;
+      len  -= 2;
+    }
+
+  words = (FAR const uint32_t *)data;
+  while (len >= 16)
+    {
+      acc   += (uint64_t)words[0] + words[1] + words[2] + words[3];
+      words += 4;
+      len   -= 16;
+    }
+
+  while (len >= 4)
+    {
+      acc += *words++;
+      len -= 4;
+    }
+
+  data = (FAR const uint8_t *)words;
+  if (len >= 2)
+    {
+      acc  += *(FAR const uint16_t *)data;
+      data += 2;
+      len  -= 2;
+    }
+
+  if (len > 0)
+    {
+      acc += chksum_tail(*data);
+    }
+
+  return chksum_fold(acc);
+#endif
+}
+
+static uint16_t chksum_copy_aligned(FAR uint8_t *dest,
+                                    FAR const uint8_t *src, size_t len)
+{
+  FAR const uint32_t *swords;
+  FAR uint32_t *dwords;
+  uint64_t acc = 0;
+  uint32_t w0;
+  uint32_t w1;
+  uint32_t w2;
+  uint32_t w3;
+
+  if (((uintptr_t)src & 2) != 0 && len >= 2)
+    {
+      *(FAR uint16_t *)dest = *(FAR const uint16_t *)src;
+      acc  += *(FAR const uint16_t *)src;
+      dest += 2;
+      src  += 2;
+      len  -= 2;
+    }
+
+  swords = (FAR const uint32_t *)src;
+  dwords = (FAR uint32_t *)dest;
+  while (len >= 16)
+    {
+      w0 = swords[0];
+      w1 = swords[1];
+      w2 = swords[2];
+      w3 = swords[3];
+
+      dwords[0] = w0;
+      dwords[1] = w1;
+      dwords[2] = w2;
+      dwords[3] = w3;
+
+      acc    += (uint64_t)w0 + w1 + w2 + w3;
+      swords += 4;
+      dwords += 4;
+      len    -= 16;
+    }
+
+  while (len >= 4)
+    {
+      w0 = *swords++;
+      *dwords++ = w0;
+      acc += w0;
+      len -= 4;
+    }
+
+  src  = (FAR const uint8_t *)swords;
+  dest = (FAR uint8_t *)dwords;
+  if (len >= 2)
+    {
+      *(FAR uint16_t *)dest = *(FAR const uint16_t *)src;
+      acc  += *(FAR const uint16_t *)src;
+      dest += 2;
+      src  += 2;
+      len  -= 2;
+    }
+
+  if (len > 0)
+    {
+      *dest = *src;
+      acc  += chksum_tail(*src);
+    }
+
+  return chksum_fold(acc);
+}
+
+/****************************************************************************
+ * Name: chksum_words
+ *
+ * Description:
+ *   Return the one's complement sum of the 16-bit big-endian words of
+ *   data, as if it started on a word boundary.  A trailing odd byte is
+ *   padded with zero.  If dest is not NULL, the data is also copied to
+ *   dest in the same pass.
+ *
+ ****************************************************************************/
+
+static uint16_t chksum_words(FAR uint8_t *dest, FAR const uint8_t *data,
+                             size_t len)
+{
+  uint16_t head;
+  uint16_t sum;
+
+  if (len == 0)
+    {
+      return 0;
+    }
+
+  if (dest != NULL && (((uintptr_t)dest ^ (uintptr_t)data) & 3) != 0)
+    {
+      /* The copy can not be done a word at a time, sum the copy while it
+       * is still in the cache.
+       */
+
+      memcpy(dest, data, len);
+      data = dest;
+      dest = NULL;
+    }
+
+  if (((uintptr_t)data & 1) == 0)
+    {
+      return dest != NULL ? chksum_copy_aligned(dest, data, len) :
+                            chksum_aligned(data, len);
+    }
+
+  /* Sum the first byte by itself, the rest of the data is then aligned
+   * but one byte off in the word stream.
+   */
+
+  head = (uint16_t)data[0] << 8;
+  if (dest != NULL)
+    {
+      *dest = data[0];
+      sum   = chksum_copy_aligned(dest + 1, data + 1, len - 1);
+    }
+  else
+    {
+      sum   = chksum_aligned(data + 1, len - 1);
+    }
+
+  sum = chksum_swap(sum) + head;
+  if (sum < head)
+    {
+      sum++; /* carry */
+    }
+
+  return sum;
+}
+
+/****************************************************************************
+ * Name: checksum and checksum_copy
  *
  * Description:
  *   Calculate the raw change sum over the memory region described by
- *   data and len.
+ *   data and len.  checksum_copy() also copies the data to dest.
  *
  * Input Parameters:
  *   sum  - Partial calculations carried over from a previous call to
  *          chksum().  This should be zero on the first time that check
  *          sum is called.
+ *   dest - Where to copy the data
  *   data - Beginning of the data to include in the checksum.
  *   len  - Length of the data to include in the checksum.
  *   odd  - the flag of the Calculated data sum
@@ -53,55 +307,29 @@
  *
  ****************************************************************************/
 
-#ifndef CONFIG_NET_ARCH_CHKSUM
-uint16_t checksum(uint16_t sum, FAR const uint8_t *data,
-                    uint16_t len, bool *odd)
+static uint16_t checksum_copy(uint16_t sum, FAR uint8_t *dest,
+                              FAR const uint8_t *data, uint16_t len,
+                              FAR bool *odd)
 {
-  FAR const uint8_t *dataptr;
-  FAR const uint8_t *last_byte;
   uint16_t t;
 
-  dataptr = data;
-  last_byte = data + len - 1;
-
-  if (*odd == true)
-    {
-      t = dataptr[0];
-      sum += t;
-      if (sum < t)
-        {
-          sum++; /* carry */
-        }
+  t = chksum_words(dest, data, len);
 
-      dataptr += 1;
-    }
+  /* If the previous data ended with an odd byte, this data starts in the
+   * middle of a word.
+   */
 
-  while (dataptr < last_byte)
+  if (*odd)
     {
-      /* At least two more bytes */
-
-      t = ((uint16_t)dataptr[0] << 8) + dataptr[1];
-      sum += t;
-      if (sum < t)
-        {
-          sum++; /* carry */
-        }
-
-      dataptr += 2;
+      t = chksum_swap(t);
     }
 
-  *odd = false;
+  *odd ^= (len & 1) != 0;
 
-  if (dataptr == last_byte)
+  sum += t;
+  if (sum < t)
     {
-      t = (dataptr[0] << 8) + 0;
-      sum += t;
-      if (sum < t)
-        {
-          sum++; /* carry */
-        }
-
-      *odd = true;
+      sum++; /* carry */
     }
 
   /* Return sum in host byte order. */
@@ -109,6 +337,12 @@ uint16_t checksum(uint16_t sum, FAR const uint8_t *data,
   return sum;
 }
 
+uint16_t checksum(uint16_t sum, FAR const uint8_t *data,
+                  uint16_t len, FAR bool *odd)
+{
+  return checksum_copy(sum, NULL, data, len, odd);
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -139,6 +373,113 @@ uint16_t chksum(uint16_t sum, FAR const uint8_t *data, uint16_t len)
   return checksum(sum, data, len, &odd);
 }
 
+/****************************************************************************
+ * Name: chksum_copy
+ *
+ * Description:
+ *   Copy len bytes from data to dest and return the raw change sum of the
+ *   copied data.  The data is summed while it is copied, so the payload is
+ *   only read once.
+ *
+ * Input Parameters:
+ *   sum  - Partial calculations carried over from a previous call to
+ *          chksum().  This should be zero on the first time that check
+ *          sum is called.
+ *   dest - Where to copy the data.
+ *   data - Beginning of the data to copy and include in the checksum.
+ *   len  - Length of the data.
+ *
+ * Returned Value:
+ *   The updated checksum value.
+ *
+ ****************************************************************************/
+
+uint16_t chksum_copy(uint16_t sum, FAR uint8_t *dest,
+                     FAR const uint8_t *data, uint16_t len)
+{
+  bool odd = false;
+
+  return checksum_copy(sum, dest, data, len, &odd);
+}
+
+/****************************************************************************
+ * Name: chksum_copyin_iob
+ *
+ * Description:
+ *   Append len bytes from src to the end of an iob chain and accumulate
+ *   the raw change sum of the appended data in *sum.  The chain is
+ *   extended with new buffers as needed.  This does the work of
+ *   iob_copyin() followed by chksum_iob() in one pass over the data.
+ *
+ * Input Parameters:
+ *   iob       - The iob chain to append to.
+ *   src       - The data to append.
+ *   len       - The number of bytes to append.
+ *   throttled - An indication of the iob allocation is "throttled"
+ *   can_block - Wait for a free iob if the pool is empty
+ *   sum       - The sum of the data already in the chain on entry, the
+ *               sum including the appended data on return.  Any data in
+ *               the chain that is not summed must have an even length.
+ *
+ * Returned Value:
+ *   The number of bytes appended on success; -ENOMEM if an iob could not
+ *   be allocated.  The chain may have been partially extended on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MM_IOB
+int chksum_copyin_iob(FAR struct iob_s *iob, FAR const uint8_t *src,
+                      unsigned int len, bool throttled, bool can_block,
+                      FAR uint16_t *sum)
+{
+  FAR struct iob_s *head = iob;
+  FAR struct iob_s *next;
+  unsigned int total = len;
+  unsigned int avail;
+  unsigned int ncopy;
+  bool odd;
+
+  /* Skip to the last I/O buffer in the chain */
+
+  while (iob->io_flink != NULL)
+    {
+      iob = iob->io_flink;
+    }
+
+  odd = (head->io_pktlen & 1) != 0;
+
+  while (len > 0)
+    {
+      avail = IOB_FREESPACE(iob);
+      if (avail == 0)
+        {
+          next = can_block ? iob_alloc_len(throttled, len) :
+                             iob_tryalloc_len(throttled, len);
+          if (next == NULL)
+            {
+              return -ENOMEM;
+            }
+
+          iob->io_flink = next;
+          iob           = next;
+          continue;
+        }
+
+      ncopy = MIN(avail, len);
+      *sum  = checksum_copy(*sum,
+                            iob->io_data + iob->io_offset + iob->io_len,
+                            src, ncopy, &odd);
+
+      iob->io_len     += ncopy;
+      head->io_pktlen += ncopy;
+      src             += ncopy;
+      len             -= ncopy;
+    }
+
+  return total;
+}
+#endif /* CONFIG_MM_IOB */
+
 #endif /* CONFIG_NET_ARCH_CHKSUM */
 
 /****************************************************************************
@@ -26,7 +26,9 @@
 
 #include <nuttx/config.h>
 #include <nuttx/net/netdev.h>
+#include <nuttx/net/udp.h>
 
+#include "netdev/netdev.h"
 #include "utils/utils.h"
 
 #ifdef CONFIG_NET_UDP
@@ -65,4 +67,65 @@ uint16_t udp_ipv6_chksum(FAR struct net_driver_s *dev)
 }
 #endif
 
+/****************************************************************************
+ * Name: udp_chksum_payload
+ *
+ * Description:
+ *   Calculate the UDP checksum of the packet in d_buf when the raw sum of
+ *   the payload is already known.  Only the pseudo-header and the UDP
+ *   header are summed here.
+ *
+ * Input Parameters:
+ *   dev    - The network device holding the UDP/IP headers
+ *   pldsum - The raw change sum of the UDP payload
+ *
+ * Returned Value:
+ *   The calculated checksum
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_NET_UDP_CHECKSUMS) && !defined(CONFIG_NET_ARCH_CHKSUM) && \
+    defined(CONFIG_MM_IOB)
+uint16_t udp_chksum_payload(FAR struct net_driver_s *dev, uint16_t pldsum)
+{
+  FAR const uint8_t *udp;
+  uint16_t sum;
+
+  /* Sum the pseudo-header */
+
+#ifdef CONFIG_NET_IPv4
+#ifdef CONFIG_NET_IPv6
+  if (IFF_IS_IPv4(dev->d_flags))
+#endif
+    {
+      sum = ipv4_upperlayer_header_chksum(dev, IP_PROTO_UDP);
+      udp = IPBUF(IPv4_HDRLEN);
+    }
+#endif /* CONFIG_NET_IPv4 */
+
+#ifdef CONFIG_NET_IPv6
+#ifdef CONFIG_NET_IPv4
+  else
+#endif
+    {
+      sum = ipv6_upperlayer_header_chksum(dev, IP_PROTO_UDP, IPv6_HDRLEN);
+      udp = IPBUF(IPv6_HDRLEN);
+    }
+#endif /* CONFIG_NET_IPv6 */
+
+  /* Sum the UDP header and add the payload sum that was accumulated when
+   * the payload was copied in.
+   */
+
+  sum  = chksum(sum, udp, UDP_HDRLEN);
+  sum += pldsum;
+  if (sum < pldsum)
+    {
+      sum++; /* carry */
+    }
+
+  return (sum == 0) ? 0xffff : HTONS(sum);
+}
+#endif
+
 #endif /* CONFIG_NET_UDP */
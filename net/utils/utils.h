@@ -546,6 +546,41 @@ void net_chksum_adjust(FAR uint16_t *chksum,
                        FAR const uint16_t *optr, ssize_t olen,
                        FAR const uint16_t *nptr, ssize_t nlen);
 
+/****************************************************************************
+ * Name: chksum_copy
+ *
+ * Description:
+ *   Copy len bytes from data to dest and return the raw change sum of the
+ *   copied data, reading the data only once.
+ *
+ ****************************************************************************/
+
+#ifndef CONFIG_NET_ARCH_CHKSUM
+uint16_t chksum_copy(uint16_t sum, FAR uint8_t *dest,
+                     FAR const uint8_t *data, uint16_t len);
+#endif
+
+/****************************************************************************
+ * Name: chksum_copyin_iob
+ *
+ * Description:
+ *   Append len bytes from src to the end of an iob chain and accumulate
+ *   the raw change sum of the appended data in *sum.  This is
+ *   iob_copyin() at the end of the chain and chksum_iob() over the new
+ *   data in a single pass.
+ *
+ * Returned Value:
+ *   The number of bytes appended on success; -ENOMEM if an iob could not
+ *   be allocated.
+ *
+ ****************************************************************************/
+
+#if !defined(CONFIG_NET_ARCH_CHKSUM) && defined(CONFIG_MM_IOB)
+int chksum_copyin_iob(FAR struct iob_s *iob, FAR const uint8_t *src,
+                      unsigned int len, bool throttled, bool can_block,
+                      FAR uint16_t *sum);
+#endif
+
 /****************************************************************************
  * Name: tcp_chksum, tcp_ipv4_chksum, and tcp_ipv6_chksum
  *
@@ -605,6 +640,26 @@ uint16_t udp_ipv4_chksum(FAR struct net_driver_s *dev);
 uint16_t udp_ipv6_chksum(FAR struct net_driver_s *dev);
 #endif
 
+/****************************************************************************
+ * Name: udp_chksum_payload
+ *
+ * Description:
+ *   Calculate the UDP checksum of the packet in d_buf when the raw sum of
+ *   the payload is already known, e.g. because it was summed while it was
+ *   copied into the write buffer.  Only the pseudo-header and the UDP
+ *   header are summed here.
+ *
+ * Input Parameters:
+ *   dev    - The network device holding the UDP/IP headers
+ *   pldsum - The raw change sum of the UDP payload
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_NET_UDP_CHECKSUMS) && !defined(CONFIG_NET_ARCH_CHKSUM) && \
+    defined(CONFIG_MM_IOB)
+uint16_t udp_chksum_payload(FAR struct net_driver_s *dev, uint16_t pldsum);
+#endif
+
 /****************************************************************************
  * Name: icmp_chksum
  *
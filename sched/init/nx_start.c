@@ -94,6 +94,13 @@
 
 dq_queue_t g_readytorun;
 
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+/* Priority index into g_readytorun, see sched/sched/sched.h */
+
+uint32_t g_rtrbitmap[RTR_BITMAP_NWORDS];
+FAR struct tcb_s *g_rtrtail[SCHED_PRIORITY_MAX + 1];
+#endif
+
 /* In order to support SMP, the function of the g_readytorun list changes,
  * The g_readytorun is still used but in the SMP case it will contain only:
  *
@@ -406,6 +413,9 @@ static void idle_task_initialize(void)
       g_assignedtasks[i] = tcb;
 #else
       dq_addfirst((FAR dq_entry_t *)tcb, TLIST_HEAD(tcb));
+#  ifdef CONFIG_SCHED_READYTORUN_BITMAP
+      nxsched_rtr_index_add(tcb);
+#  endif
 #endif
 
       /* Mark the idle task as the running task */
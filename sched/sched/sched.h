@@ -31,6 +31,8 @@
 
 #include <sys/types.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <strings.h>
 #include <sched.h>
 
 #include <nuttx/arch.h>
@@ -44,6 +46,21 @@
 
 #define PIDHASH(pid)             ((pid) & (g_npidhash - 1))
 
+/* Size of the ready-to-run priority bitmap in 32-bit words */
+
+#define RTR_BITMAP_NWORDS        ((SCHED_PRIORITY_MAX + 32) / 32)
+
+/* Change the priority of the running task in place, without moving it in
+ * the ready-to-run list.  Only in the non-SMP case is the running task a
+ * member of g_readytorun.
+ */
+
+#if defined(CONFIG_SCHED_READYTORUN_BITMAP) && !defined(CONFIG_SMP)
+#  define nxsched_running_priority(t,p) nxsched_rtr_set_priority(t, p)
+#else
+#  define nxsched_running_priority(t,p) ((t)->sched_priority = (uint8_t)(p))
+#endif
+
 /* The state of a task is indicated both by the task_state field of the TCB
  * and by a series of task lists.  All of these tasks lists are declared
  * below. Although it is not always necessary, most of these lists are
@@ -167,6 +184,18 @@ enum task_deliver_e
 
 extern dq_queue_t g_readytorun;
 
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+/* Index into g_readytorun:  Bit 'n' of g_rtrbitmap is set when at least one
+ * task of priority 'n' is in the list and g_rtrtail[n] is the last such
+ * task.  Tasks of one priority are contiguous in the list, so each level
+ * behaves as a FIFO and the insertion point for a new task is just after
+ * the tail of the lowest occupied level at or above its priority.
+ */
+
+extern uint32_t g_rtrbitmap[RTR_BITMAP_NWORDS];
+extern FAR struct tcb_s *g_rtrtail[SCHED_PRIORITY_MAX + 1];
+#endif
+
 #ifdef CONFIG_SMP
 /* In order to support SMP, the function of the g_readytorun list changes,
  * The g_readytorun is still used but in the SMP case it will contain only:
@@ -455,6 +484,92 @@ FAR char **nxsched_get_stackargs(FAR struct tcb_s *tcb);
  * Inline functions
  ****************************************************************************/
 
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+/* Record that 'tcb' has just been linked into g_readytorun.  It becomes the
+ * tail of its priority level unless it was placed in front of another task
+ * of the same priority.
+ */
+
+static inline_function void nxsched_rtr_index_add(FAR struct tcb_s *tcb)
+{
+  uint8_t prio = tcb->sched_priority;
+
+  if (tcb->flink == NULL || tcb->flink->sched_priority != prio)
+    {
+      g_rtrtail[prio] = tcb;
+      g_rtrbitmap[prio >> 5] |= (uint32_t)1 << (prio & 31);
+    }
+}
+
+/* Forget 'tcb' before it is unlinked from g_readytorun */
+
+static inline_function void nxsched_rtr_index_remove(FAR struct tcb_s *tcb)
+{
+  uint8_t prio = tcb->sched_priority;
+
+  if (g_rtrtail[prio] == tcb)
+    {
+      if (tcb->blink != NULL && tcb->blink->sched_priority == prio)
+        {
+          g_rtrtail[prio] = tcb->blink;
+        }
+      else
+        {
+          g_rtrtail[prio] = NULL;
+          g_rtrbitmap[prio >> 5] &= ~((uint32_t)1 << (prio & 31));
+        }
+    }
+}
+
+/* Return the task after which a task of priority 'prio' must be inserted,
+ * or NULL if it belongs at the head of g_readytorun.
+ */
+
+static inline_function FAR struct tcb_s *nxsched_rtr_prev(uint8_t prio)
+{
+  int word = prio >> 5;
+  uint32_t bits;
+
+  bits = g_rtrbitmap[word] & ~(((uint32_t)1 << (prio & 31)) - 1);
+  while (bits == 0)
+    {
+      if (++word >= RTR_BITMAP_NWORDS)
+        {
+          return NULL;
+        }
+
+      bits = g_rtrbitmap[word];
+    }
+
+  return g_rtrtail[(word << 5) + ffs(bits) - 1];
+}
+
+/* Change the priority of a task that stays where it is in g_readytorun,
+ * i.e. the running task when the new priority does not alter its position.
+ */
+
+static inline_function void nxsched_rtr_set_priority(FAR struct tcb_s *tcb,
+                                                     uint8_t priority)
+{
+  nxsched_rtr_index_remove(tcb);
+  tcb->sched_priority = priority;
+  nxsched_rtr_index_add(tcb);
+}
+#endif
+
+static inline_function void
+nxsched_remove_prioritized(FAR struct tcb_s *tcb, DSEG dq_queue_t *list)
+{
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+  if (list == list_readytorun())
+    {
+      nxsched_rtr_index_remove(tcb);
+    }
+#endif
+
+  dq_rem((FAR dq_entry_t *)tcb, list);
+}
+
 static inline_function bool nxsched_add_prioritized(FAR struct tcb_s *tcb,
                                                     DSEG dq_queue_t *list)
 {
@@ -467,6 +582,27 @@ static inline_function bool nxsched_add_prioritized(FAR struct tcb_s *tcb,
 
   DEBUGASSERT(sched_priority >= SCHED_PRIORITY_MIN);
 
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+  /* The ready-to-run list is indexed:  no need to search it */
+
+  if (list == list_readytorun())
+    {
+      prev = nxsched_rtr_prev(sched_priority);
+      if (prev == NULL)
+        {
+          dq_addfirst((FAR dq_entry_t *)tcb, list);
+          ret = true;
+        }
+      else
+        {
+          dq_addafter((FAR dq_entry_t *)prev, (FAR dq_entry_t *)tcb, list);
+        }
+
+      nxsched_rtr_index_add(tcb);
+      return ret;
+    }
+#endif
+
   /* Search the list to find the location to insert the new Tcb.
    * Each is list is maintained in descending sched_priority order.
    */
@@ -188,7 +188,7 @@ bool nxsched_switch_running(int cpu, bool switch_equal)
         {
           /* Found a task, remove it from ready-to-run list */
 
-          dq_rem((FAR struct dq_entry_s *)btcb, list_readytorun());
+          nxsched_remove_prioritized(btcb, list_readytorun());
 
           if (!is_idle_task(rtcb))
             {
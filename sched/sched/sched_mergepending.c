@@ -137,6 +137,10 @@ bool nxsched_merge_pending(void)
               ptcb->task_state  = TSTATE_TASK_READYTORUN;
             }
 
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+          nxsched_rtr_index_add(ptcb);
+#endif
+
           /* Set up for the next time through */
 
           rtcb = ptcb;
@@ -139,7 +139,7 @@ static inline void nxsched_running_setpriority(FAR struct tcb_s *tcb,
 
           /* Change the task priority */
 
-          tcb->sched_priority = (uint8_t)sched_priority;
+          nxsched_running_priority(tcb, sched_priority);
         }
       else
         {
@@ -159,7 +159,7 @@ static inline void nxsched_running_setpriority(FAR struct tcb_s *tcb,
     {
       /* Change the task priority */
 
-      tcb->sched_priority = (uint8_t)sched_priority;
+      nxsched_running_priority(tcb, sched_priority);
     }
 }
 
@@ -188,7 +188,7 @@ static void nxsched_readytorun_setpriority(FAR struct tcb_s *tcb,
   rtcb = this_task();
 
 #ifdef CONFIG_SMP
-  dq_rem((FAR struct dq_entry_s *)tcb, list_readytorun());
+  nxsched_remove_prioritized(tcb, list_readytorun());
   tcb->sched_priority = sched_priority;
   if (nxsched_add_readytorun(tcb))
 #else
@@ -34,12 +34,14 @@
  * Public Data
  ****************************************************************************/
 
+#ifndef CONFIG_WDOG_WHEEL
 /* The g_wdactivelist data structure is a singly linked list ordered by
  * watchdog expiration time. When watchdog timers expire,the functions on
  * this linked list are removed and the function is called.
  */
 
 struct list_node g_wdactivelist = LIST_INITIAL_VALUE(g_wdactivelist);
+#endif
 
 #ifdef CONFIG_HRTIMER
 struct hrtimer_s g_wdtimer;
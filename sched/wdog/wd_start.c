@@ -122,9 +122,9 @@ static inline_function clock_t wd_expiration(clock_t ticks)
    * other watchdogs that became ready to run at this time
    */
 
-  while (!list_is_empty(&g_wdactivelist))
+  while (!wd_list_empty())
     {
-      wdog = list_first_entry(&g_wdactivelist, struct wdog_s, node);
+      wdog = wd_first();
 
       /* Check if watchdog has expired;
        * re-evaluate after updating current ticks if needed
@@ -138,7 +138,7 @@ static inline_function clock_t wd_expiration(clock_t ticks)
 
       /* Remove the watchdog from the head of the list */
 
-      list_delete_fast(&wdog->node);
+      wd_remove(wdog);
 
       /* Indicate that the watchdog is no longer active. */
 
@@ -169,7 +169,8 @@ static inline_function clock_t wd_expiration(clock_t ticks)
  *
  * Description:
  *   Insert the timer into the global list to ensure that
- *   the list is sorted in increasing order of expiration absolute time.
+ *   the list is sorted in increasing order of expiration absolute time,
+ *   or into its timing wheel slot if CONFIG_WDOG_WHEEL is enabled.
  *
  * Input Parameters:
  *   wdog     - Watchdog ID
@@ -189,6 +190,14 @@ static inline_function
 bool wd_insert(FAR struct wdog_s *wdog, clock_t expired,
                wdentry_t wdentry, wdparm_t arg)
 {
+#ifdef CONFIG_WDOG_WHEEL
+  wdog->func = wdentry;
+  up_getpicbase(&wdog->picbase);
+  wdog->arg = arg;
+  wdog->expired = expired;
+
+  return wd_wheel_insert(wdog);
+#else
   FAR struct wdog_s *curr;
   FAR struct wdog_s *head;
 
@@ -223,6 +232,7 @@ bool wd_insert(FAR struct wdog_s *wdog, clock_t expired,
   /* Return whether the head of the watchdog list has changed. */
 
   return head == curr;
+#endif
 }
 
 /****************************************************************************
@@ -292,8 +302,7 @@ int wd_start_abstick(FAR struct wdog_s *wdog, clock_t ticks,
 
       if (WDOG_ISACTIVE(wdog))
         {
-          reassess |= list_is_head(&g_wdactivelist, &wdog->node);
-          list_delete_fast(&wdog->node);
+          reassess |= wd_remove(wdog);
         }
 
       reassess |= wd_insert(wdog, ticks, wdentry, arg);
@@ -315,7 +324,7 @@ int wd_start_abstick(FAR struct wdog_s *wdog, clock_t ticks,
 
       if (WDOG_ISACTIVE(wdog))
         {
-          list_delete_fast(&wdog->node);
+          wd_remove(wdog);
         }
 
       wd_insert(wdog, ticks, wdentry, arg);
@@ -0,0 +1,216 @@
+/****************************************************************************
+ * sched/wdog/wd_wheel.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <strings.h>
+#include <assert.h>
+
+#include <nuttx/list.h>
+#include <nuttx/wdog.h>
+
+#include "wdog/wdog.h"
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* A slot list is only valid while its bit is set in g_wdwheelmap; it is
+ * (re)initialized when its first watchdog is added.
+ */
+
+struct list_node g_wdwheel[CONFIG_WDOG_WHEEL_SLOTS];
+uint32_t g_wdwheelmap[WDOG_WHEEL_NWORDS];
+unsigned int g_wdwheelcount;
+clock_t g_wdwheelnext;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wd_wheel_update
+ *
+ * Description:
+ *   Recompute g_wdwheelnext after the earliest watchdog has been removed.
+ *   The occupied slots are visited in tick order starting from the slot of
+ *   the removed expiration time 'base'.  Since no active watchdog expires
+ *   before 'base', the first slot whose earliest watchdog falls in the
+ *   current turn of the wheel holds the answer; otherwise every watchdog
+ *   is at least one turn away and the earliest of the slot heads is used.
+ *
+ ****************************************************************************/
+
+static void wd_wheel_update(clock_t base)
+{
+  FAR struct wdog_s *wdog;
+  clock_t next = base;
+  bool found = false;
+  unsigned int slot = base & WDOG_WHEEL_MASK;
+  unsigned int n = 0;
+
+  while (n < CONFIG_WDOG_WHEEL_SLOTS)
+    {
+      uint32_t bits = g_wdwheelmap[slot >> 5] >> (slot & 31);
+
+      if (bits == 0)
+        {
+          /* Nothing more in this word, skip to the next one */
+
+          n   += 32 - (slot & 31);
+          slot = (slot + 32 - (slot & 31)) & WDOG_WHEEL_MASK;
+          continue;
+        }
+
+      n   += ffs(bits) - 1;
+      slot = (slot + ffs(bits) - 1) & WDOG_WHEEL_MASK;
+      if (n >= CONFIG_WDOG_WHEEL_SLOTS)
+        {
+          break;
+        }
+
+      wdog = list_first_entry(&g_wdwheel[slot], struct wdog_s, node);
+      if (wdog->expired == base + n)
+        {
+          g_wdwheelnext = wdog->expired;
+          return;
+        }
+
+      if (!found || !clock_compare(next, wdog->expired))
+        {
+          next  = wdog->expired;
+          found = true;
+        }
+
+      n++;
+      slot = (slot + 1) & WDOG_WHEEL_MASK;
+    }
+
+  DEBUGASSERT(found);
+  g_wdwheelnext = next;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wd_wheel_insert
+ *
+ * Description:
+ *   Add a watchdog, whose expiration time has already been set, to the
+ *   timing wheel.
+ *
+ * Input Parameters:
+ *   wdog - Watchdog ID
+ *
+ * Returned Value:
+ *   Whether the earliest expiration time has changed.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+bool wd_wheel_insert(FAR struct wdog_s *wdog)
+{
+  FAR struct list_node *list = WDOG_WHEEL_SLOT(wdog->expired);
+  unsigned int slot = wdog->expired & WDOG_WHEEL_MASK;
+  uint32_t bit = (uint32_t)1 << (slot & 31);
+  FAR struct wdog_s *curr;
+  bool ret;
+
+  if ((g_wdwheelmap[slot >> 5] & bit) == 0)
+    {
+      list_initialize(list);
+      g_wdwheelmap[slot >> 5] |= bit;
+    }
+
+  /* The slot is kept sorted by expiration time, with watchdogs expiring
+   * at the same tick in FIFO order.  A new watchdog usually expires last,
+   * so search from the tail.
+   */
+
+  list_for_every_entry_reverse(list, curr, struct wdog_s, node)
+    {
+      if (clock_compare(curr->expired, wdog->expired))
+        {
+          break;
+        }
+    }
+
+  list_add_after(&curr->node, &wdog->node);
+
+  ret = g_wdwheelcount++ == 0 ||
+        !clock_compare(g_wdwheelnext, wdog->expired);
+  if (ret)
+    {
+      g_wdwheelnext = wdog->expired;
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: wd_wheel_remove
+ *
+ * Description:
+ *   Remove an active watchdog from the timing wheel.
+ *
+ * Input Parameters:
+ *   wdog - Watchdog ID
+ *
+ * Returned Value:
+ *   Whether the watchdog was the one expiring first.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+bool wd_wheel_remove(FAR struct wdog_s *wdog)
+{
+  FAR struct list_node *list = WDOG_WHEEL_SLOT(wdog->expired);
+  unsigned int slot = wdog->expired & WDOG_WHEEL_MASK;
+  bool first = wdog->expired == g_wdwheelnext;
+
+  DEBUGASSERT(g_wdwheelcount > 0);
+
+  list_delete_fast(&wdog->node);
+  if (list_is_empty(list))
+    {
+      g_wdwheelmap[slot >> 5] &= ~((uint32_t)1 << (slot & 31));
+    }
+
+  if (--g_wdwheelcount > 0 && first)
+    {
+      wd_wheel_update(wdog->expired);
+    }
+
+  return first;
+}
@@ -46,6 +46,17 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+#ifdef CONFIG_WDOG_WHEEL
+#  if (CONFIG_WDOG_WHEEL_SLOTS & (CONFIG_WDOG_WHEEL_SLOTS - 1)) != 0 || \
+      CONFIG_WDOG_WHEEL_SLOTS < 32
+#    error CONFIG_WDOG_WHEEL_SLOTS must be a power of two, at least 32
+#  endif
+
+#  define WDOG_WHEEL_MASK        (CONFIG_WDOG_WHEEL_SLOTS - 1)
+#  define WDOG_WHEEL_NWORDS      (CONFIG_WDOG_WHEEL_SLOTS / 32)
+#  define WDOG_WHEEL_SLOT(t)     (&g_wdwheel[(t) & WDOG_WHEEL_MASK])
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -58,12 +69,25 @@ extern "C"
 #define EXTERN extern
 #endif
 
+#ifdef CONFIG_WDOG_WHEEL
+/* The active watchdogs are hashed by expiration tick into g_wdwheel.  Each
+ * slot is a list ordered by expiration time, and g_wdwheelmap has a bit
+ * set for every non-empty slot.  g_wdwheelnext caches the earliest
+ * expiration time of all g_wdwheelcount active watchdogs.
+ */
+
+extern struct list_node g_wdwheel[CONFIG_WDOG_WHEEL_SLOTS];
+extern uint32_t g_wdwheelmap[WDOG_WHEEL_NWORDS];
+extern unsigned int g_wdwheelcount;
+extern clock_t g_wdwheelnext;
+#else
 /* The g_wdactivelist data structure is a singly linked list ordered by
  * watchdog expiration time. When watchdog timers expire,the functions on
  * this linked list are removed and the function is called.
  */
 
 extern struct list_node g_wdactivelist;
+#endif
 
 #ifdef CONFIG_HRTIMER
 extern struct hrtimer_s g_wdtimer;
@@ -110,6 +134,49 @@ void wd_timer(clock_t ticks);
 uint64_t wd_timer(const hrtimer_t *timer, uint64_t expired);
 #endif
 
+/****************************************************************************
+ * Name: wd_wheel_insert
+ *
+ * Description:
+ *   Add a watchdog, whose expiration time has already been set, to the
+ *   timing wheel.
+ *
+ * Input Parameters:
+ *   wdog - Watchdog ID
+ *
+ * Returned Value:
+ *   Whether the earliest expiration time has changed.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_WDOG_WHEEL
+bool wd_wheel_insert(FAR struct wdog_s *wdog);
+#endif
+
+/****************************************************************************
+ * Name: wd_wheel_remove
+ *
+ * Description:
+ *   Remove an active watchdog from the timing wheel.
+ *
+ * Input Parameters:
+ *   wdog - Watchdog ID
+ *
+ * Returned Value:
+ *   Whether the watchdog was the one expiring first.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_WDOG_WHEEL
+bool wd_wheel_remove(FAR struct wdog_s *wdog);
+#endif
+
 /****************************************************************************
  * Inline functions
  ****************************************************************************/
@@ -194,11 +261,36 @@ static inline_function void wd_timer_cancel(void)
 #  define wd_timer_cancel()
 #endif
 
+#ifdef CONFIG_WDOG_WHEEL
+#  define wd_list_empty()        (g_wdwheelcount == 0)
+#  define wd_next_expire()       (g_wdwheelnext)
+#  define wd_remove(wdog)        wd_wheel_remove(wdog)
+
+/* The earliest watchdog is the first one in the slot of g_wdwheelnext */
+
+#  define wd_first() \
+     list_first_entry(WDOG_WHEEL_SLOT(g_wdwheelnext), struct wdog_s, node)
+#else
+#  define wd_list_empty()        list_is_empty(&g_wdactivelist)
+#  define wd_first() \
+     list_first_entry(&g_wdactivelist, struct wdog_s, node)
+
 static inline_function clock_t wd_next_expire(void)
 {
-  return list_first_entry(&g_wdactivelist, struct wdog_s, node)->expired;
+  return wd_first()->expired;
 }
 
+/* Remove a watchdog, return whether it was at the head of the list */
+
+static inline_function bool wd_remove(FAR struct wdog_s *wdog)
+{
+  bool head = list_is_head(&g_wdactivelist, &wdog->node);
+
+  list_delete_fast(&wdog->node);
+  return head;
+}
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -208,7 +300,7 @@ static inline_function clock_t wd_get_next_expire(clock_t curr)
   clock_t     next = curr;
   irqstate_t flags = enter_critical_section();
 
-  if (!list_is_empty(&g_wdactivelist))
+  if (!wd_list_empty())
     {
       next = wd_next_expire();
     }
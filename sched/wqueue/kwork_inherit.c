@@ -36,22 +36,22 @@
 #include "sched/sched.h"
 #include "wqueue/wqueue.h"
 
-#if defined(CONFIG_SCHED_WORKQUEUE) && defined(CONFIG_SCHED_LPWORK) && \
-    defined(CONFIG_PRIORITY_INHERITANCE)
+#if defined(CONFIG_SCHED_WORKQUEUE) && defined(CONFIG_PRIORITY_INHERITANCE)
 
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
 /****************************************************************************
- * Name: lpwork_boostworker
+ * Name: work_boostworker
  *
  * Description:
- *   Called by the work queue client to assure that the priority of the low-
- *   priority worker thread is at least at the requested level, reqprio. This
+ *   Called by the work queue client to assure that the priority of one
+ *   worker thread is at least at the requested level, reqprio. This
  *   function would normally be called just before calling work_queue().
  *
  * Input Parameters:
+ *   wpid    - The task ID of the worker thread
  *   reqprio - Requested minimum worker thread priority
  *
  * Returned Value:
@@ -59,11 +59,11 @@
  *
  ****************************************************************************/
 
-static void lpwork_boostworker(pid_t wpid, uint8_t reqprio)
+static void work_boostworker(pid_t wpid, uint8_t reqprio)
 {
   FAR struct tcb_s *wtcb;
 
-  /* Get the TCB of the low priority worker thread from the process ID. */
+  /* Get the TCB of the worker thread from the process ID. */
 
   wtcb = nxsched_get_tcb(wpid);
   DEBUGASSERT(wtcb);
@@ -108,7 +108,7 @@ static void lpwork_boostworker(pid_t wpid, uint8_t reqprio)
 }
 
 /****************************************************************************
- * Name: lpwork_restoreworker
+ * Name: work_restoreworker
  *
  * Description:
  *   This function is called to restore the priority after it was previously
@@ -117,6 +117,7 @@ static void lpwork_boostworker(pid_t wpid, uint8_t reqprio)
  *   priority of the worker thread.
  *
  * Input Parameters:
+ *   wpid    - The task ID of the worker thread
  *   reqprio - Previously requested minimum worker thread priority to be
  *     "unboosted"
  *
@@ -125,11 +126,11 @@ static void lpwork_boostworker(pid_t wpid, uint8_t reqprio)
  *
  ****************************************************************************/
 
-static void lpwork_restoreworker(pid_t wpid, uint8_t reqprio)
+static void work_restoreworker(pid_t wpid, uint8_t reqprio)
 {
   FAR struct tcb_s *wtcb;
 
-  /* Get the TCB of the low priority worker thread from the process ID. */
+  /* Get the TCB of the worker thread from the process ID. */
 
   wtcb = nxsched_get_tcb(wpid);
   DEBUGASSERT(wtcb);
@@ -191,14 +192,16 @@ static void lpwork_restoreworker(pid_t wpid, uint8_t reqprio)
  ****************************************************************************/
 
 /****************************************************************************
- * Name: lpwork_boostpriority
+ * Name: work_boostpriority_wq
  *
  * Description:
- *   Called by the work queue client to assure that the priority of the low-
- *   priority worker thread is at least at the requested level, reqprio. This
- *   function would normally be called just before calling work_queue().
+ *   Called by the work queue client to assure that the priority of the
+ *   worker threads of wqueue is at least at the requested level, reqprio.
+ *   This function would normally be called just before calling
+ *   work_queue_wq().
  *
  * Input Parameters:
+ *   wqueue  - The work queue handle
  *   reqprio - Requested minimum worker thread priority
  *
  * Returned Value:
@@ -206,32 +209,94 @@ static void lpwork_restoreworker(pid_t wpid, uint8_t reqprio)
  *
  ****************************************************************************/
 
-void lpwork_boostpriority(uint8_t reqprio)
+void work_boostpriority_wq(FAR struct kwork_wqueue_s *wqueue,
+                           uint8_t reqprio)
 {
+  FAR struct kworker_s *kworker = wq_get_worker(wqueue);
   irqstate_t flags;
   int wndx;
 
-  /* Clip to the configured maximum priority */
+  /* Prevent context switches until we get the priorities right */
 
-  if (reqprio > CONFIG_SCHED_LPWORKPRIOMAX)
+  flags = enter_critical_section();
+
+  /* Adjust the priority of every worker thread */
+
+  for (wndx = 0; wndx < wqueue->nthreads; wndx++)
     {
-      reqprio = CONFIG_SCHED_LPWORKPRIOMAX;
+      work_boostworker(kworker[wndx].pid, reqprio);
     }
 
+  leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: work_restorepriority_wq
+ *
+ * Description:
+ *   This function is called to restore the priority of the worker threads
+ *   of wqueue after it was previously boosted by work_boostpriority_wq().
+ *
+ * Input Parameters:
+ *   wqueue  - The work queue handle
+ *   reqprio - Previously requested minimum worker thread priority to be
+ *     "unboosted"
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void work_restorepriority_wq(FAR struct kwork_wqueue_s *wqueue,
+                             uint8_t reqprio)
+{
+  FAR struct kworker_s *kworker = wq_get_worker(wqueue);
+  irqstate_t flags;
+  int wndx;
+
   /* Prevent context switches until we get the priorities right */
 
   flags = enter_critical_section();
 
   /* Adjust the priority of every worker thread */
 
-  for (wndx = 0; wndx < CONFIG_SCHED_LPNTHREADS; wndx++)
+  for (wndx = 0; wndx < wqueue->nthreads; wndx++)
     {
-      lpwork_boostworker(g_lpwork.worker[wndx].pid, reqprio);
+      work_restoreworker(kworker[wndx].pid, reqprio);
     }
 
   leave_critical_section(flags);
 }
 
+/****************************************************************************
+ * Name: lpwork_boostpriority
+ *
+ * Description:
+ *   Called by the work queue client to assure that the priority of the low-
+ *   priority worker thread is at least at the requested level, reqprio. This
+ *   function would normally be called just before calling work_queue().
+ *
+ * Input Parameters:
+ *   reqprio - Requested minimum worker thread priority
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_LPWORK
+void lpwork_boostpriority(uint8_t reqprio)
+{
+  /* Clip to the configured maximum priority */
+
+  if (reqprio > CONFIG_SCHED_LPWORKPRIOMAX)
+    {
+      reqprio = CONFIG_SCHED_LPWORKPRIOMAX;
+    }
+
+  work_boostpriority_wq(&g_lpwork.wq, reqprio);
+}
+
 /****************************************************************************
  * Name: lpwork_restorepriority
  *
@@ -252,9 +317,6 @@ void lpwork_boostpriority(uint8_t reqprio)
 
 void lpwork_restorepriority(uint8_t reqprio)
 {
-  irqstate_t flags;
-  int wndx;
-
   /* Clip to the configured maximum priority */
 
   if (reqprio > CONFIG_SCHED_LPWORKPRIOMAX)
@@ -262,19 +324,8 @@ void lpwork_restorepriority(uint8_t reqprio)
       reqprio = CONFIG_SCHED_LPWORKPRIOMAX;
     }
 
-  /* Prevent context switches until we get the priorities right */
-
-  flags = enter_critical_section();
-
-  /* Adjust the priority of every worker thread */
-
-  for (wndx = 0; wndx < CONFIG_SCHED_LPNTHREADS; wndx++)
-    {
-      lpwork_restoreworker(g_lpwork.worker[wndx].pid, reqprio);
-    }
-
-  leave_critical_section(flags);
+  work_restorepriority_wq(&g_lpwork.wq, reqprio);
 }
+#endif /* CONFIG_SCHED_LPWORK */
 
-#endif /* CONFIG_SCHED_WORKQUEUE && CONFIG_SCHED_LPWORK && \
-        * CONFIG_PRIORITY_INHERITANCE */
+#endif /* CONFIG_SCHED_WORKQUEUE && CONFIG_PRIORITY_INHERITANCE */
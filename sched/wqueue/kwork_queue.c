@@ -71,6 +71,7 @@ int work_queue_next_wq(FAR struct kwork_wqueue_s *wqueue,
                        FAR struct work_s *work, worker_t worker,
                        FAR void *arg, clock_t delay)
 {
+  FAR struct kworker_s *kworker = NULL;
   irqstate_t flags;
 
   if (wqueue == NULL || work == NULL || worker == NULL ||
@@ -104,15 +105,19 @@ int work_queue_next_wq(FAR struct kwork_wqueue_s *wqueue,
       /* Insert to the expired list of the wqueue. */
 
       list_add_tail(&wqueue->expired, &work->node);
+
+      /* Claim an idle worker thread, preferring this CPU's one. */
+
+      kworker = work_idle_worker(wqueue);
     }
 
   spin_unlock_irqrestore(&wqueue->lock, flags);
 
-  if (!delay)
+  if (kworker != NULL)
     {
       /* Immediately wake up the worker thread. */
 
-      nxsem_post(&wqueue->sem);
+      nxsem_post(&kworker->sem);
     }
 
   return 0;
@@ -158,6 +163,7 @@ int work_queue_wq(FAR struct kwork_wqueue_s *wqueue,
                   FAR struct work_s *work, worker_t worker,
                   FAR void *arg, clock_t delay)
 {
+  FAR struct kworker_s *kworker = NULL;
   irqstate_t flags;
   clock_t expected;
   bool retimer;
@@ -204,6 +210,10 @@ int work_queue_wq(FAR struct kwork_wqueue_s *wqueue,
       /* Insert to the expired list of the wqueue. */
 
       list_add_tail(&wqueue->expired, &work->node);
+
+      /* Claim an idle worker thread, preferring this CPU's one. */
+
+      kworker = work_idle_worker(wqueue);
     }
 
   if (retimer)
@@ -213,11 +223,11 @@ int work_queue_wq(FAR struct kwork_wqueue_s *wqueue,
 
   spin_unlock_irqrestore(&wqueue->lock, flags);
 
-  if (!delay)
+  if (kworker != NULL)
     {
       /* Immediately wake up the worker thread. */
 
-      nxsem_post(&wqueue->sem);
+      nxsem_post(&kworker->sem);
     }
 
   return 0;
@@ -87,7 +87,6 @@ struct hp_wqueue_s g_hpwork =
     LIST_INITIAL_VALUE(g_hpwork.wq.expired),
     LIST_INITIAL_VALUE(g_hpwork.wq.pending),
     SEM_INITIALIZER(0),
-    SEM_INITIALIZER(0),
     SP_UNLOCKED,
     CONFIG_SCHED_HPNTHREADS,
   }
@@ -104,7 +103,6 @@ struct lp_wqueue_s g_lpwork =
     LIST_INITIAL_VALUE(g_lpwork.wq.expired),
     LIST_INITIAL_VALUE(g_lpwork.wq.pending),
     SEM_INITIALIZER(0),
-    SEM_INITIALIZER(0),
     SP_UNLOCKED,
     CONFIG_SCHED_LPNTHREADS,
   }
@@ -119,8 +117,9 @@ struct lp_wqueue_s g_lpwork =
 static inline_function
 void work_dispatch(FAR struct kwork_wqueue_s *wq)
 {
-  FAR struct work_s *work;
-  FAR struct work_s *next;
+  FAR struct kworker_s *kworker;
+  FAR struct work_s    *work;
+  FAR struct work_s    *next;
   unsigned int count = 0;
   clock_t      ticks = clock_systime_ticks();
 
@@ -150,13 +149,13 @@ void work_dispatch(FAR struct kwork_wqueue_s *wq)
       list_add_tail(&wq->expired, &work->node);
 
       /* Note that the thread execution this function is also
-       * a worker thread, which has already been woken up by the timer.
-       * So only `count - 1` semaphore will be posted.
+       * a worker thread, which will run the first expired work itself.
+       * So only `count - 1` idle worker threads will be woken up.
        */
 
-      if (count++ > 0)
+      if (count++ > 0 && (kworker = work_idle_worker(wq)) != NULL)
         {
-          nxsem_post(&wq->sem);
+          nxsem_post(&kworker->sem);
         }
     }
 }
@@ -202,17 +201,16 @@ static int work_thread(int argc, FAR char *argv[])
   /* Loop until wqueue->exit != 0.
    * Since the only way to set wqueue->exit is to call work_queue_free(),
    * there is no need for entering the critical section.
+   *
+   * The lock is held at the top of each iteration, so that all expired
+   * work is drained in one batch per wakeup and the worker thread only
+   * sleeps once the expired queue is empty.
    */
 
+  flags = spin_lock_irqsave_nopreempt(&wqueue->lock);
+
   while (!wqueue->exit)
     {
-      /* And check first entry in the work queue. Since we have disabled
-       * interrupts we know:  (1) we will not be suspended unless we do
-       * so ourselves, and (2) there will be no changes to the work queue
-       */
-
-       flags = spin_lock_irqsave_nopreempt(&wqueue->lock);
-
       /* If the wqueue timer is expired and non-active, it indicates that
        * there might be expired work in the pending queue.
        */
@@ -222,59 +220,72 @@ static int work_thread(int argc, FAR char *argv[])
           work_dispatch(wqueue);
         }
 
-      if (!list_is_empty(&wqueue->expired))
+      if (list_is_empty(&wqueue->expired))
         {
-          work = list_first_entry(&wqueue->expired, struct work_s, node);
+          /* Nothing left to do, mark the thread idle and wait for the
+           * semaphore to be posted by a producer or by the wqueue timer.
+           */
 
-          list_delete(&work->node);
+          kworker->idle = true;
+          wqueue->nidle++;
 
-          /* Extract the work description from the entry (in case the
-           * work instance will be reused after it has been de-queued).
-           */
+          spin_unlock_irqrestore_nopreempt(&wqueue->lock, flags);
+          nxsem_wait_uninterruptible(&kworker->sem);
+          flags = spin_lock_irqsave_nopreempt(&wqueue->lock);
+          continue;
+        }
 
-          worker = work->worker;
+      /* And check first entry in the work queue. Since we have disabled
+       * interrupts we know:  (1) we will not be suspended unless we do
+       * so ourselves, and (2) there will be no changes to the work queue
+       */
 
-          /* Extract the work argument (before re-enabling interrupts) */
+      work = list_first_entry(&wqueue->expired, struct work_s, node);
 
-          arg = work->arg;
+      list_delete(&work->node);
 
-          /* Return the work structure ownership to the work owner. */
+      /* Extract the work description from the entry (in case the
+       * work instance will be reused after it has been de-queued).
+       */
 
-          work->worker = NULL;
+      worker = work->worker;
 
-          /* Mark the thread busy */
+      /* Extract the work argument (before re-enabling interrupts) */
 
-          kworker->work = work;
+      arg = work->arg;
 
-          spin_unlock_irqrestore_nopreempt(&wqueue->lock, flags);
+      /* Return the work structure ownership to the work owner. */
 
-          /* Do the work.  Re-enable interrupts while the work is being
-           * performed... we don't have any idea how long this will take!
-           */
+      work->worker = NULL;
 
-          CALL_WORKER(worker, arg);
-          flags = spin_lock_irqsave_nopreempt(&wqueue->lock);
+      /* Mark the thread busy */
 
-          /* Mark the thread un-busy */
+      kworker->work = work;
 
-          kworker->work = NULL;
+      spin_unlock_irqrestore_nopreempt(&wqueue->lock, flags);
 
-          /* Check if someone is waiting, if so, wakeup it */
+      /* Do the work.  Re-enable interrupts while the work is being
+       * performed... we don't have any idea how long this will take!
+       */
 
-          while (kworker->wait_count > 0)
-            {
-              kworker->wait_count--;
-              nxsem_post(&kworker->wait);
-            }
-        }
+      CALL_WORKER(worker, arg);
+      flags = spin_lock_irqsave_nopreempt(&wqueue->lock);
 
-      spin_unlock_irqrestore_nopreempt(&wqueue->lock, flags);
+      /* Mark the thread un-busy */
+
+      kworker->work = NULL;
 
-      /* Wait for the semaphore to be posted by the wqueue timer. */
+      /* Check if someone is waiting, if so, wakeup it */
 
-      nxsem_wait_uninterruptible(&wqueue->sem);
+      while (kworker->wait_count > 0)
+        {
+          kworker->wait_count--;
+          nxsem_post(&kworker->wait);
+        }
     }
 
+  spin_unlock_irqrestore_nopreempt(&wqueue->lock, flags);
+
   nxsem_post(&wqueue->exsem);
   return OK;
 }
@@ -309,6 +320,9 @@ static int work_thread_create(FAR const char *name, int priority,
   int wndx;
   int pid;
   FAR void *stack = NULL;
+#ifdef CONFIG_SCHED_LPWORK_AFFINITY
+  cpu_set_t cpuset;
+#endif
 
   /* Don't permit any of the threads to run until we have fully initialized
    * all of them.
@@ -318,7 +332,11 @@ static int work_thread_create(FAR const char *name, int priority,
 
   for (wndx = 0; wndx < wqueue->nthreads; wndx++)
     {
+      nxsem_init(&worker[wndx].sem, 0, 0);
       nxsem_init(&worker[wndx].wait, 0, 0);
+#ifdef CONFIG_SMP
+      worker[wndx].cpu = -1;
+#endif
 
       snprintf(arg0, sizeof(arg0), "%p", wqueue);
       snprintf(arg1, sizeof(arg1), "%p", &worker[wndx]);
@@ -345,6 +363,22 @@ static int work_thread_create(FAR const char *name, int priority,
         }
 
       worker[wndx].pid = pid;
+
+#ifdef CONFIG_SCHED_LPWORK_AFFINITY
+      /* Bind the low-priority worker threads round-robin to the CPUs, so
+       * that work_idle_worker() can prefer the submitting CPU.
+       */
+
+      if (wqueue == &g_lpwork.wq)
+        {
+          CPU_ZERO(&cpuset);
+          CPU_SET(wndx % CONFIG_SMP_NCPUS, &cpuset);
+          if (nxsched_set_affinity(pid, sizeof(cpu_set_t), &cpuset) >= 0)
+            {
+              worker[wndx].cpu = wndx % CONFIG_SMP_NCPUS;
+            }
+        }
+#endif
     }
 
   sched_unlock();
@@ -373,7 +407,21 @@ void work_timer_expired(wdparm_t arg)
    */
 
   FAR struct kwork_wqueue_s *wq = (FAR struct kwork_wqueue_s *)arg;
-  nxsem_post(&wq->sem);
+  FAR struct kworker_s *kworker;
+  irqstate_t flags;
+
+  /* If no worker thread is idle, a busy one will dispatch the expired
+   * work once it finishes its current work.
+   */
+
+  flags   = spin_lock_irqsave(&wq->lock);
+  kworker = work_idle_worker(wq);
+  spin_unlock_irqrestore(&wq->lock, flags);
+
+  if (kworker != NULL)
+    {
+      nxsem_post(&kworker->sem);
+    }
 }
 
 /****************************************************************************
@@ -425,7 +473,6 @@ FAR struct kwork_wqueue_s *work_queue_create(FAR const char *name,
   list_initialize(&wqueue->expired);
   list_initialize(&wqueue->pending);
   wqueue->timer.func = NULL;
-  nxsem_init(&wqueue->sem, 0, 0);
   nxsem_init(&wqueue->exsem, 0, 0);
   wqueue->nthreads = nthreads;
   spin_lock_init(&wqueue->lock);
@@ -460,6 +507,7 @@ FAR struct kwork_wqueue_s *work_queue_create(FAR const char *name,
 
 int work_queue_free(FAR struct kwork_wqueue_s *wqueue)
 {
+  FAR struct kworker_s *kworker;
   int wndx;
 
   if (wqueue == NULL)
@@ -467,6 +515,7 @@ int work_queue_free(FAR struct kwork_wqueue_s *wqueue)
       return -EINVAL;
     }
 
+  kworker = wq_get_worker(wqueue);
   wd_cancel(&wqueue->timer);
 
   /* Mark the work queue as exiting */
@@ -477,7 +526,7 @@ int work_queue_free(FAR struct kwork_wqueue_s *wqueue)
 
   for (wndx = 0; wndx < wqueue->nthreads; wndx++)
     {
-      nxsem_post(&wqueue->sem);
+      nxsem_post(&kworker[wndx].sem);
     }
 
   for (wndx = 0; wndx < wqueue->nthreads; wndx++)
@@ -485,7 +534,11 @@ int work_queue_free(FAR struct kwork_wqueue_s *wqueue)
       nxsem_wait_uninterruptible(&wqueue->exsem);
     }
 
-  nxsem_destroy(&wqueue->sem);
+  for (wndx = 0; wndx < wqueue->nthreads; wndx++)
+    {
+      nxsem_destroy(&kworker[wndx].sem);
+    }
+
   nxsem_destroy(&wqueue->exsem);
   kmm_free(wqueue);
 
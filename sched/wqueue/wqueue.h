@@ -65,8 +65,13 @@ struct kworker_s
 {
   pid_t             pid;       /* The task ID of the worker thread */
   FAR struct work_s *work;     /* The work structure */
+  sem_t             sem;       /* Posted to wake up the idle worker */
   sem_t             wait;      /* Sync waiting for worker done */
   int16_t           wait_count;
+  bool              idle;      /* Waiting on sem for more work */
+#ifdef CONFIG_SMP
+  int16_t           cpu;       /* The CPU the worker is bound to, or -1 */
+#endif
 };
 
 /* This structure defines the state of one kernel-mode work queue */
@@ -75,10 +80,10 @@ struct kwork_wqueue_s
 {
   struct list_node expired;   /* The queue of expired work. */
   struct list_node pending;   /* The queue of pending work. */
-  sem_t            sem;       /* The counting semaphore of the wqueue */
   sem_t            exsem;     /* Sync waiting for thread exit */
   spinlock_t       lock;      /* Spinlock */
   uint8_t          nthreads;  /* Number of worker threads */
+  uint8_t          nidle;     /* Number of idle worker threads */
   bool             exit;      /* A flag to request the thread to exit */
   struct wdog_s    timer;     /* Timer to pending. */
 };
@@ -242,6 +247,60 @@ bool work_remove(FAR struct kwork_wqueue_s *wqueue,
   return head == work;
 }
 
+/****************************************************************************
+ * Name: work_idle_worker
+ *
+ * Description:
+ *   Internal public function to claim an idle worker thread of the
+ *   workqueue so that it can be woken up.  A worker bound to the calling
+ *   CPU is preferred.  The caller must post the returned worker's sem,
+ *   after releasing the wqueue lock unless pre-emption is disabled.
+ *
+ * Input Parameters:
+ *   wqueue - The work queue.
+ *
+ * Returned Value:
+ *   The claimed worker, or NULL if every worker is busy.  Busy workers
+ *   drain the expired queue before going idle, so nothing is lost.
+ *
+ * Assumptions:
+ *   The caller holds wqueue->lock.
+ *
+ ****************************************************************************/
+
+static inline_function
+FAR struct kworker_s *work_idle_worker(FAR struct kwork_wqueue_s *wqueue)
+{
+  FAR struct kworker_s *kworker = wq_get_worker(wqueue);
+  FAR struct kworker_s *found = NULL;
+  int wndx;
+
+  if (wqueue->nidle == 0)
+    {
+      return NULL;
+    }
+
+  for (wndx = 0; wndx < wqueue->nthreads; wndx++)
+    {
+      if (kworker[wndx].idle)
+        {
+          found = &kworker[wndx];
+#ifdef CONFIG_SMP
+          if (found->cpu == this_cpu())
+#endif
+            {
+              break;
+            }
+        }
+    }
+
+  DEBUGASSERT(found != NULL);
+
+  found->idle = false;
+  wqueue->nidle--;
+  return found;
+}
+
 /****************************************************************************
  * Name: work_timer_expired
  *
@@ -343,9 +343,11 @@ static void btnet_l2cap_receive(FAR struct bt_conn_s *conn,
   frame      = buf->frame;
   buf->frame = NULL;
 
+  priv = (FAR struct btnet_driver_s *)context;
+  netdev_lock(&priv->bd_dev.r_dev);
+
   /* Ignore the frame if the network is not up */
 
-  priv = (FAR struct btnet_driver_s *)context;
   if (!IFF_IS_RUNNING(priv->bd_dev.r_dev.d_flags))
     {
       wlwarn("WARNING: Dropped... Network is down\n");
@@ -374,8 +376,6 @@ static void btnet_l2cap_receive(FAR struct bt_conn_s *conn,
 
   /* Transfer the frame to the network logic */
 
-  net_lock();
-
 #ifdef CONFIG_NET_BLUETOOTH
   /* Invoke the PF_BLUETOOTH tap first.  If the frame matches
    * with a connected PF_BLUETOOTH socket, it will take the
@@ -434,7 +434,7 @@ drop:
   /* Release our reference on the buffer */
 
   bt_buf_release(buf);
-  net_unlock();
+  netdev_unlock(&priv->bd_dev.r_dev);
 }
 
 /****************************************************************************
@@ -504,11 +504,11 @@ static void btnet_hci_received(FAR struct bt_buf_s *buf, FAR void *context)
   frame      = buf->frame;
   buf->frame = NULL;
 
-  net_lock();
+  priv = (FAR struct btnet_driver_s *)context;
+  netdev_lock(&priv->bd_dev.r_dev);
 
   /* Ignore the frame if the network is not up */
 
-  priv = (FAR struct btnet_driver_s *)context;
   if (!IFF_IS_RUNNING(priv->bd_dev.r_dev.d_flags))
     {
       wlwarn("WARNING: Dropped... Network is down\n");
@@ -582,7 +582,7 @@ drop:
 
   /* Release our reference on the buffer */
 
-  net_unlock();
+  netdev_unlock(&priv->bd_dev.r_dev);
 }
 
 #endif
@@ -721,7 +721,7 @@ static void btnet_txavail_work(FAR void *arg)
    * thread has been configured.
    */
 
-  net_lock();
+  netdev_lock(&priv->bd_dev.r_dev);
 
   /* Ignore the notification if the interface is not yet up */
 
@@ -738,7 +738,7 @@ static void btnet_txavail_work(FAR void *arg)
       devif_poll(&priv->bd_dev.r_dev, btnet_txpoll_callback);
     }
 
-  net_unlock();
+  netdev_unlock(&priv->bd_dev.r_dev);
 }
 
 /****************************************************************************